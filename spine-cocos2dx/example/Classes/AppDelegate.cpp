@@ -50,6 +50,7 @@ AppDelegate::AppDelegate() {
 AppDelegate::~AppDelegate() {
 	SkeletonBatch::destroyInstance();
 	SkeletonTwoColorBatch::destroyInstance();
+	StringTable::clear();
 	debugExtension.reportLeaks();
 }
 
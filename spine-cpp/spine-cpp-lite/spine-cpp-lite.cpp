@@ -78,6 +78,15 @@ typedef struct _spine_skeleton_drawable : public SpineObject {
 	SkeletonRenderer *renderer;
 } _spine_skeleton_drawable;
 
+typedef struct _spine_drawable_batch : public SpineObject {
+	SkeletonBatchUpdater *updater;
+	Vector<_spine_skeleton_drawable *> drawables;
+	Vector<int32_t> eventDrawables;
+	Vector<int32_t> eventTypes;
+	Vector<spine_track_entry> eventTrackEntries;
+	Vector<spine_event> events;
+} _spine_drawable_batch;
+
 typedef struct _spine_skin_entry {
 	int32_t slotIndex;
 	utf8 *name;
@@ -94,6 +103,10 @@ static Color NULL_COLOR(0, 0, 0, 0);
 static SpineExtension *defaultExtension = nullptr;
 static DebugExtension *debugExtension = nullptr;
 
+// Skeleton data share the names interned by the loaders, see StringTable, so the table can only be freed while no
+// skeleton data are loaded.
+static int32_t numSkeletonData = 0;
+
 static void initExtensions() {
 	if (defaultExtension == nullptr) {
 		defaultExtension = new DefaultSpineExtension();
@@ -121,6 +134,7 @@ int32_t spine_minor_version() {
 
 void spine_report_leaks() {
 	initExtensions();
+	if (numSkeletonData == 0) StringTable::clear();
 	debugExtension->reportLeaks();
 	fflush(stdout);
 }
@@ -255,6 +269,7 @@ spine_skeleton_data_result spine_skeleton_data_load_json(spine_atlas atlas, cons
 	SkeletonJson json((Atlas *) _atlas->atlas);
 	SkeletonData *data = json.readSkeletonData(skeletonData);
 	result->skeletonData = (spine_skeleton_data) data;
+	if (data) numSkeletonData++;
 	if (!json.getError().isEmpty()) {
 		result->error = (utf8 *) strdup(json.getError().buffer());
 	}
@@ -272,6 +287,7 @@ spine_skeleton_data_result spine_skeleton_data_load_binary(spine_atlas atlas, co
 	SkeletonBinary binary((Atlas *) _atlas->atlas);
 	SkeletonData *data = binary.readSkeletonData(skeletonData, length);
 	result->skeletonData = (spine_skeleton_data) data;
+	if (data) numSkeletonData++;
 	if (!binary.getError().isEmpty()) {
 		result->error = (utf8 *) strdup(binary.getError().buffer());
 	}
@@ -561,6 +577,7 @@ float spine_skeleton_data_get_reference_scale(spine_skeleton_data data) {
 void spine_skeleton_data_dispose(spine_skeleton_data data) {
 	if (!data) return;
 	delete (SkeletonData *) data;
+	numSkeletonData--;
 }
 
 // SkeletonDrawable
@@ -619,6 +636,112 @@ spine_animation_state_events spine_skeleton_drawable_get_animation_state_events(
 	return ((_spine_skeleton_drawable *) drawable)->animationStateEvents;
 }
 
+// DrawableBatch
+
+spine_drawable_batch spine_drawable_batch_create(int32_t threadCount) {
+	TaskRunner *taskRunner = nullptr;
+#ifndef SPINE_NO_THREADS
+	if (threadCount != 0) taskRunner = new (__FILE__, __LINE__) ThreadPoolTaskRunner(threadCount);
+#else
+	SP_UNUSED(threadCount);
+#endif
+	_spine_drawable_batch *batch = new (__FILE__, __LINE__) _spine_drawable_batch();
+	batch->updater = new (__FILE__, __LINE__) SkeletonBatchUpdater(taskRunner, true);
+	return (spine_drawable_batch) batch;
+}
+
+void spine_drawable_batch_dispose(spine_drawable_batch batch) {
+	if (batch == nullptr) return;
+	_spine_drawable_batch *_batch = (_spine_drawable_batch *) batch;
+	delete _batch->updater;
+	delete _batch;
+}
+
+int32_t spine_drawable_batch_add(spine_drawable_batch batch, spine_skeleton_drawable drawable) {
+	if (batch == nullptr) return -1;
+	if (drawable == nullptr) return -1;
+	_spine_drawable_batch *_batch = (_spine_drawable_batch *) batch;
+	_spine_skeleton_drawable *_drawable = (_spine_skeleton_drawable *) drawable;
+	_batch->drawables.add(_drawable);
+	return (int32_t) _batch->updater->add((AnimationState *) _drawable->animationState, (Skeleton *) _drawable->skeleton, 0, _drawable->renderer);
+}
+
+void spine_drawable_batch_clear(spine_drawable_batch batch) {
+	if (batch == nullptr) return;
+	_spine_drawable_batch *_batch = (_spine_drawable_batch *) batch;
+	_batch->updater->clear();
+	_batch->drawables.clear();
+	_batch->eventDrawables.clear();
+	_batch->eventTypes.clear();
+	_batch->eventTrackEntries.clear();
+	_batch->events.clear();
+}
+
+int32_t spine_drawable_batch_get_num_drawables(spine_drawable_batch batch) {
+	if (batch == nullptr) return 0;
+	return (int32_t) ((_spine_drawable_batch *) batch)->drawables.size();
+}
+
+void spine_drawable_batch_update(spine_drawable_batch batch, float delta, spine_physics physics, spine_bool render) {
+	if (batch == nullptr) return;
+	_spine_drawable_batch *_batch = (_spine_drawable_batch *) batch;
+	SkeletonBatchUpdater *updater = _batch->updater;
+	for (size_t i = 0, n = updater->size(); i < n; i++)
+		updater->setDelta(i, delta);
+	updater->setRender(render);
+	updater->update((Physics) physics);
+
+	_batch->eventDrawables.clear();
+	_batch->eventTypes.clear();
+	_batch->eventTrackEntries.clear();
+	_batch->events.clear();
+	for (size_t i = 0, n = _batch->drawables.size(); i < n; i++) {
+		Vector<AnimationStateEvent> &events = ((EventListener *) _batch->drawables[i]->animationStateEvents)->events;
+		for (size_t ii = 0, nn = events.size(); ii < nn; ii++) {
+			AnimationStateEvent &event = events[ii];
+			_batch->eventDrawables.add((int32_t) i);
+			_batch->eventTypes.add((int32_t) event.type);
+			_batch->eventTrackEntries.add((spine_track_entry) event.entry);
+			_batch->events.add((spine_event) event.event);
+		}
+		events.clear();
+	}
+}
+
+int32_t spine_drawable_batch_get_render_commands(spine_drawable_batch batch, spine_render_command *renderCommands) {
+	if (batch == nullptr) return 0;
+	if (renderCommands == nullptr) return 0;
+	SkeletonBatchUpdater *updater = ((_spine_drawable_batch *) batch)->updater;
+	for (size_t i = 0, n = updater->size(); i < n; i++)
+		renderCommands[i] = (spine_render_command) updater->getRenderCommands(i);
+	return (int32_t) updater->size();
+}
+
+int32_t spine_drawable_batch_get_num_events(spine_drawable_batch batch) {
+	if (batch == nullptr) return 0;
+	return (int32_t) ((_spine_drawable_batch *) batch)->events.size();
+}
+
+int32_t *spine_drawable_batch_get_event_drawables(spine_drawable_batch batch) {
+	if (batch == nullptr) return nullptr;
+	return ((_spine_drawable_batch *) batch)->eventDrawables.buffer();
+}
+
+int32_t *spine_drawable_batch_get_event_types(spine_drawable_batch batch) {
+	if (batch == nullptr) return nullptr;
+	return ((_spine_drawable_batch *) batch)->eventTypes.buffer();
+}
+
+spine_track_entry *spine_drawable_batch_get_event_track_entries(spine_drawable_batch batch) {
+	if (batch == nullptr) return nullptr;
+	return ((_spine_drawable_batch *) batch)->eventTrackEntries.buffer();
+}
+
+spine_event *spine_drawable_batch_get_events(spine_drawable_batch batch) {
+	if (batch == nullptr) return nullptr;
+	return ((_spine_drawable_batch *) batch)->events.buffer();
+}
+
 // Render command
 float *spine_render_command_get_positions(spine_render_command command) {
 	if (!command) return nullptr;
@@ -1491,6 +1614,88 @@ void spine_skeleton_update(spine_skeleton skeleton, float delta) {
 	_skeleton->update(delta);
 }
 
+// Returns the number of items to process, clamped to the number of items if indices is NULL.
+static int32_t bulkCount(const int32_t *indices, int32_t count, size_t size) {
+	if (count < 0) return 0;
+	if (indices == nullptr && (size_t) count > size) return (int32_t) size;
+	return count;
+}
+
+// Returns the index of the i-th item, or -1 if it is out of range.
+static int32_t bulkIndex(const int32_t *indices, int32_t i, size_t size) {
+	int32_t index = indices ? indices[i] : i;
+	return index >= 0 && (size_t) index < size ? index : -1;
+}
+
+int32_t spine_skeleton_get_bone_world_transforms(spine_skeleton skeleton, const int32_t *boneIndices, int32_t count, float *transforms) {
+	if (skeleton == nullptr || transforms == nullptr) return 0;
+	Skeleton *_skeleton = (Skeleton *) skeleton;
+	Vector<Bone *> &bones = _skeleton->getBones();
+	count = bulkCount(boneIndices, count, bones.size());
+	for (int32_t i = 0; i < count; i++, transforms += 6) {
+		int32_t index = bulkIndex(boneIndices, i, bones.size());
+		if (index < 0) return i;
+		Bone *bone = bones[index];
+		transforms[0] = bone->getA();
+		transforms[1] = bone->getB();
+		transforms[2] = bone->getC();
+		transforms[3] = bone->getD();
+		transforms[4] = bone->getWorldX();
+		transforms[5] = bone->getWorldY();
+	}
+	return count;
+}
+
+int32_t spine_skeleton_set_bone_local_transforms(spine_skeleton skeleton, const int32_t *boneIndices, int32_t count, const float *transforms) {
+	if (skeleton == nullptr || transforms == nullptr) return 0;
+	Skeleton *_skeleton = (Skeleton *) skeleton;
+	Vector<Bone *> &bones = _skeleton->getBones();
+	count = bulkCount(boneIndices, count, bones.size());
+	for (int32_t i = 0; i < count; i++, transforms += 7) {
+		int32_t index = bulkIndex(boneIndices, i, bones.size());
+		if (index < 0) return i;
+		Bone *bone = bones[index];
+		bone->setX(transforms[0]);
+		bone->setY(transforms[1]);
+		bone->setRotation(transforms[2]);
+		bone->setScaleX(transforms[3]);
+		bone->setScaleY(transforms[4]);
+		bone->setShearX(transforms[5]);
+		bone->setShearY(transforms[6]);
+	}
+	return count;
+}
+
+int32_t spine_skeleton_get_slot_colors(spine_skeleton skeleton, const int32_t *slotIndices, int32_t count, float *colors) {
+	if (skeleton == nullptr || colors == nullptr) return 0;
+	Skeleton *_skeleton = (Skeleton *) skeleton;
+	Vector<Slot *> &slots = _skeleton->getSlots();
+	count = bulkCount(slotIndices, count, slots.size());
+	for (int32_t i = 0; i < count; i++, colors += 4) {
+		int32_t index = bulkIndex(slotIndices, i, slots.size());
+		if (index < 0) return i;
+		Color &color = slots[index]->getColor();
+		colors[0] = color.r;
+		colors[1] = color.g;
+		colors[2] = color.b;
+		colors[3] = color.a;
+	}
+	return count;
+}
+
+int32_t spine_skeleton_get_slot_attachments(spine_skeleton skeleton, const int32_t *slotIndices, int32_t count, spine_attachment *attachments) {
+	if (skeleton == nullptr || attachments == nullptr) return 0;
+	Skeleton *_skeleton = (Skeleton *) skeleton;
+	Vector<Slot *> &slots = _skeleton->getSlots();
+	count = bulkCount(slotIndices, count, slots.size());
+	for (int32_t i = 0; i < count; i++) {
+		int32_t index = bulkIndex(slotIndices, i, slots.size());
+		if (index < 0) return i;
+		attachments[i] = (spine_attachment) slots[index]->getAttachment();
+	}
+	return count;
+}
+
 // EventData
 const utf8 *spine_event_data_get_name(spine_event_data event) {
 	if (event == nullptr) return nullptr;
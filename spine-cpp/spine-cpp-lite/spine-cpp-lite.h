@@ -102,6 +102,7 @@ SPINE_OPAQUE_TYPE(spine_bounds)
 SPINE_OPAQUE_TYPE(spine_color)
 SPINE_OPAQUE_TYPE(spine_vector)
 SPINE_OPAQUE_TYPE(spine_skeleton_drawable)
+SPINE_OPAQUE_TYPE(spine_drawable_batch)
 SPINE_OPAQUE_TYPE(spine_skin_entry)
 SPINE_OPAQUE_TYPE(spine_skin_entries)
 
@@ -286,6 +287,34 @@ SPINE_CPP_LITE_EXPORT spine_animation_state spine_skeleton_drawable_get_animatio
 SPINE_CPP_LITE_EXPORT spine_animation_state_data spine_skeleton_drawable_get_animation_state_data(spine_skeleton_drawable drawable);
 SPINE_CPP_LITE_EXPORT spine_animation_state_events spine_skeleton_drawable_get_animation_state_events(spine_skeleton_drawable drawable);
 
+// Updates, poses and renders many drawables with one call per frame. If threadCount is 0, drawables are updated on the
+// calling thread, if < 0 on the calling thread and one worker thread less than the hardware concurrency, otherwise on
+// the calling thread and threadCount worker threads. Worker threads require the debug extension to be disabled.
+// @ignore
+SPINE_CPP_LITE_EXPORT spine_drawable_batch spine_drawable_batch_create(int32_t threadCount);
+SPINE_CPP_LITE_EXPORT void spine_drawable_batch_dispose(spine_drawable_batch batch);
+// Adds a drawable, which must not be disposed before it is removed with spine_drawable_batch_clear(). Returns its index.
+SPINE_CPP_LITE_EXPORT int32_t spine_drawable_batch_add(spine_drawable_batch batch, spine_skeleton_drawable drawable);
+SPINE_CPP_LITE_EXPORT void spine_drawable_batch_clear(spine_drawable_batch batch);
+SPINE_CPP_LITE_EXPORT int32_t spine_drawable_batch_get_num_drawables(spine_drawable_batch batch);
+// For each drawable, updates and applies the animation state, updates the skeleton and its world transform, and renders
+// it if render is true. The animation state events of all drawables are then moved to the batch's event buffer.
+SPINE_CPP_LITE_EXPORT void spine_drawable_batch_update(spine_drawable_batch batch, float delta, spine_physics physics, spine_bool render);
+// Writes the render commands of each drawable from the last update, or NULL if it had nothing to render, to
+// renderCommands, which must have room for spine_drawable_batch_get_num_drawables() entries.
+// @ignore
+SPINE_CPP_LITE_EXPORT int32_t spine_drawable_batch_get_render_commands(spine_drawable_batch batch, spine_render_command *renderCommands);
+// The events of the last update, stored as one array per field, valid until the next update.
+SPINE_CPP_LITE_EXPORT int32_t spine_drawable_batch_get_num_events(spine_drawable_batch batch);
+// @ignore
+SPINE_CPP_LITE_EXPORT int32_t *spine_drawable_batch_get_event_drawables(spine_drawable_batch batch);
+// @ignore
+SPINE_CPP_LITE_EXPORT int32_t *spine_drawable_batch_get_event_types(spine_drawable_batch batch);
+// @ignore
+SPINE_CPP_LITE_EXPORT spine_track_entry *spine_drawable_batch_get_event_track_entries(spine_drawable_batch batch);
+// @ignore
+SPINE_CPP_LITE_EXPORT spine_event *spine_drawable_batch_get_events(spine_drawable_batch batch);
+
 // @ignore
 SPINE_CPP_LITE_EXPORT float *spine_render_command_get_positions(spine_render_command command);
 // @ignore
@@ -462,6 +491,21 @@ SPINE_CPP_LITE_EXPORT void spine_skeleton_set_scale_y(spine_skeleton skeleton, f
 SPINE_CPP_LITE_EXPORT float spine_skeleton_get_time(spine_skeleton skeleton);
 SPINE_CPP_LITE_EXPORT void spine_skeleton_set_time(spine_skeleton skeleton, float time);
 SPINE_CPP_LITE_EXPORT void spine_skeleton_update(spine_skeleton skeleton, float delta);
+// Bulk pose access, so hosts make one call per frame instead of one per bone or slot. The indices select bones or slots
+// by their index in the skeleton, or the first count bones or slots if indices is NULL. Each function returns the number
+// of entries processed, which is less than count if an index is out of range.
+// Writes 6 floats per bone: a, b, c, d, worldX, worldY.
+// @ignore
+SPINE_CPP_LITE_EXPORT int32_t spine_skeleton_get_bone_world_transforms(spine_skeleton skeleton, const int32_t *boneIndices, int32_t count, float *transforms);
+// Reads 7 floats per bone: x, y, rotation, scaleX, scaleY, shearX, shearY. Call spine_skeleton_update_world_transform() after.
+// @ignore
+SPINE_CPP_LITE_EXPORT int32_t spine_skeleton_set_bone_local_transforms(spine_skeleton skeleton, const int32_t *boneIndices, int32_t count, const float *transforms);
+// Writes 4 floats per slot: r, g, b, a.
+// @ignore
+SPINE_CPP_LITE_EXPORT int32_t spine_skeleton_get_slot_colors(spine_skeleton skeleton, const int32_t *slotIndices, int32_t count, float *colors);
+// Writes the attachment of each slot, or NULL. The handles identify attachments across frames.
+// @ignore
+SPINE_CPP_LITE_EXPORT int32_t spine_skeleton_get_slot_attachments(spine_skeleton skeleton, const int32_t *slotIndices, int32_t count, spine_attachment *attachments);
 
 SPINE_CPP_LITE_EXPORT const utf8 *spine_event_data_get_name(spine_event_data event);
 SPINE_CPP_LITE_EXPORT int32_t spine_event_data_get_int_value(spine_event_data event);
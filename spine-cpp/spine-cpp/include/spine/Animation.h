@@ -47,6 +47,8 @@ namespace spine {
 
 	class AnimationState;
 
+	class SkeletonData;
+
 	class SP_API Animation : public SpineObject {
 		friend class AnimationState;
 
@@ -96,6 +98,10 @@ namespace spine {
 
 		friend class TwoColorTimeline;
 
+		friend class SkeletonData;
+
+		friend class SkeletonBinary;
+
 	public:
 		Animation(const String &name, Vector<Timeline *> &timelines, float duration);
 
@@ -116,15 +122,31 @@ namespace spine {
 
 		void setDuration(float inValue);
 
+		/// False if the animation was read with SkeletonBinary::setLazyAnimations() and its timelines have not been
+		/// decoded yet or were unloaded, see SkeletonData::loadAnimation().
+		bool isLoaded();
+
+		/// Finds the index of the last frame at or before the target time. Uses a binary search for larger frame counts.
 		/// @param target After the first and before the last entry.
 		static int search(Vector<float> &values, float target);
 
+		/// Same as search(Vector<float>&, float), for frames that are step entries apart.
 		static int search(Vector<float> &values, float target, int step);
 	private:
 		Vector<Timeline *> _timelines;
 		HashMap<PropertyId, bool> _timelineIds;
 		float _duration;
 		String _name;
+
+		// Set for animations read with SkeletonBinary::setLazyAnimations(), guarded by the skeleton data's lock.
+		SkeletonData *_lazyData;
+		size_t _lazyOffset;
+		size_t _memory;
+		size_t _lastUse;
+		int _useCount;
+		bool _loaded;
+
+		void setTimelines(Vector<Timeline *> &timelines);
 	};
 }
 
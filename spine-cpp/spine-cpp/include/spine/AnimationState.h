@@ -388,6 +388,8 @@ namespace spine {
 		TrackEntry *setAnimation(size_t trackIndex, const String &animationName, bool loop);
 
 		/// Sets the current animation for a track, discarding any queued animations.
+		/// @param animation If read with SkeletonBinary::setLazyAnimations(), it is loaded while the track entry uses it. If
+		/// it cannot be decoded, the track entry plays the empty animation instead, see SkeletonData::loadAnimation().
 		/// @param loop If true, the animation will repeat.
 		/// If false, it will not, instead its last frame is applied if played beyond its duration.
 		/// In either case TrackEntry.TrackEnd determines when the track is cleared.
@@ -402,6 +404,7 @@ namespace spine {
 
 		/// Adds an animation to be played delay seconds after the current or last queued animation
 		/// for a track. If the track is empty, it is equivalent to calling setAnimation.
+		/// @param animation Loaded like for setAnimation().
 		/// @param delay
 		/// Seconds to begin this animation after the start of the previous animation. May be &lt;= 0 to use the animation
 		/// duration of the previous track minus any mix duration plus the negative delay.
@@ -514,7 +517,8 @@ namespace spine {
 
 		void computeHold(TrackEntry *entry);
 
-		void setAttachment(Skeleton &skeleton, spine::Slot &slot, const String &attachmentName, bool attachments);
+		void setAttachment(Skeleton &skeleton, spine::Slot &slot, const String &attachmentName, int attachmentId,
+						   bool attachments);
 	};
 }
 
@@ -0,0 +1,141 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_Arena_h
+#define Spine_Arena_h
+
+#include <spine/BlockAllocator.h>
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	/// A bump allocator built on BlockAllocator, used to load all allocations belonging to one SkeletonData into a few
+	/// large blocks, see SkeletonJson::setUseArena() and SkeletonBinary::setUseArena().
+	///
+	/// While an arena is current on a thread, see ArenaScope, SpineExtension::alloc(), calloc() and realloc() of NULL
+	/// on that thread allocate from the arena. SpineExtension::free() of memory owned by an arena does not release it,
+	/// all of it is released when the arena is deleted. Memory owned by an arena can be freed or reallocated whichever
+	/// arena is current, see findOwner(). When another arena or none is current, realloc() moves it out of its arena.
+	/// Memory owned by an arena must not be freed while that arena is allocated from on another thread.
+	class SP_API Arena : public SpineObject {
+	public:
+		explicit Arena(int blockSize = 64 * 1024);
+
+		~Arena();
+
+		void *alloc(size_t size, bool clear);
+
+		/// Grows the allocation in place if it is the last one in its block, otherwise moves it to a new allocation.
+		void *realloc(void *ptr, size_t size);
+
+		/// Only accounts for the allocation no longer being used, the memory is released when the arena is deleted.
+		void free(void *ptr);
+
+		/// Returns true if the memory was allocated from this arena or an arena merged into it.
+		bool owns(const void *ptr);
+
+		/// Returns the live arena that owns the memory, or NULL if it was not allocated from an arena.
+		static Arena *findOwner(const void *ptr);
+
+		/// Returns the size requested for memory allocated from an arena.
+		static size_t getAllocationSize(const void *ptr);
+
+		/// Takes ownership of another arena, so its allocations belong to this arena and are released when this arena
+		/// is deleted. Used to combine arenas that were allocated from on different threads. The other arena must not be
+		/// allocated from afterwards.
+		void merge(Arena *other);
+
+		/// The size in bytes of all blocks allocated by the arena.
+		size_t getSize();
+
+		/// The bytes in the arena's blocks that are not used by live allocations, including allocation headers, padding,
+		/// freed allocations and the unused end of each block.
+		size_t getWaste();
+
+		/// The arena allocations on the calling thread go to, or NULL.
+		static Arena *getCurrent();
+
+		/// Sets the arena allocations on the calling thread go to and returns the previous one.
+		static Arena *setCurrent(Arena *arena);
+
+	private:
+		struct Range {
+			const uint8_t *start;
+			const uint8_t *end;
+		};
+
+		BlockAllocator _blocks;
+		size_t _numBlocks;
+		Vector<Range> _ranges;
+		Vector<Arena *> _merged;
+		size_t _size;
+		size_t _used;
+
+		void addRanges();
+
+		void addRange(const uint8_t *start, const uint8_t *end);
+
+		Arena(const Arena &);
+
+		Arena &operator=(const Arena &);
+	};
+
+	/// Makes an arena current on the calling thread until the scope ends, then restores the previous arena.
+	class SP_API ArenaScope {
+	public:
+		/// Creates an inactive scope, see enter().
+		ArenaScope();
+
+		/// @param arena May be NULL, so nothing is allocated from an arena within the scope.
+		/// @param ownsArena If true, the arena is deleted when the scope ends.
+		explicit ArenaScope(Arena *arena, bool ownsArena = false);
+
+		~ArenaScope();
+
+		void enter(Arena *arena, bool ownsArena = false);
+
+		/// Restores the previous arena before the scope ends, deleting the arena if the scope owns it.
+		void exit();
+
+		/// Keeps the arena from being deleted when the scope ends. It stays current until then.
+		Arena *release();
+
+	private:
+		Arena *_arena;
+		Arena *_previous;
+		bool _active;
+		bool _ownsArena;
+
+		ArenaScope(const ArenaScope &);
+
+		ArenaScope &operator=(const ArenaScope &);
+	};
+}
+
+#endif /* Spine_Arena_h */
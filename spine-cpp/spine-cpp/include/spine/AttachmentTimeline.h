@@ -50,6 +50,8 @@ namespace spine {
 
 		friend class SkeletonJson;
 
+		friend class SkeletonData;
+
 	RTTI_DECL
 
 	public:
@@ -64,18 +66,25 @@ namespace spine {
 		/// Sets the time and value of the specified keyframe.
 		void setFrame(int frame, float time, const String &attachmentName);
 
+		/// Call SkeletonData::updateAttachmentIds() after changing names directly.
 		Vector<String> &getAttachmentNames();
 
+		/// The attachment id of each keyframe's name for the timeline's slot, see SkeletonData::updateAttachmentIds().
+		/// -1 if the name is empty or was set after the ids were updated.
+		Vector<int> &getAttachmentIds();
+
 		int getSlotIndex() { return _slotIndex; }
 
-		void setSlotIndex(int inValue) { _slotIndex = inValue; }
+		void setSlotIndex(int inValue);
 
 	protected:
 		int _slotIndex;
 
 		Vector<String> _attachmentNames;
 
-		void setAttachment(Skeleton &skeleton, Slot &slot, String *attachmentName);
+		Vector<int> _attachmentIds;
+
+		void setAttachment(Skeleton &skeleton, Slot &slot, const String &attachmentName, int attachmentId);
 	};
 }
 
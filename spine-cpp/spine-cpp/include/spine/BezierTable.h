@@ -0,0 +1,81 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_BezierTable_h
+#define Spine_BezierTable_h
+
+#include <spine/HashMap.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	/// Stores the bezier curves of quantized timelines, see CurveTimeline::quantize(). A curve is stored as the 9 points
+	/// CurveTimeline evaluates it with, normalized so the curve goes from 0,0 to 1,1: x as a fraction of the frame's
+	/// duration times X_ONE and y as a fraction of the value's change times Y_ONE. Curves with the same shape, like
+	/// the easing used throughout an animation, are stored once and shared by all timelines.
+	///
+	/// The table allocates from the heap, not from the arena that is current. Not thread safe.
+	class SP_API BezierTable : public SpineObject {
+	public:
+		/// The number of shorts per curve, an x and y for each point.
+		static const int SIZE = 18;
+		static const int X_ONE = 32767;
+		static const int Y_ONE = 16384;
+
+		BezierTable();
+
+		~BezierTable();
+
+		/// Returns the stored curve with the same SIZE values, storing a copy if there is none.
+		/// @return Valid until the table is deleted.
+		const short *add(const short *values);
+
+		/// The number of distinct curves.
+		size_t size();
+
+		/// The bytes used by the curves and the table.
+		size_t getMemory();
+
+	private:
+		struct Key {
+			const short *values;
+
+			explicit Key(const short *values = NULL) : values(values) {}
+
+			size_t hash() const;
+
+			bool operator==(const Key &other) const;
+		};
+
+		HashMap<Key, const short *> _curves;
+		Vector<short *> _blocks;
+		size_t _blockUsed;
+	};
+}
+
+#endif /* Spine_BezierTable_h */
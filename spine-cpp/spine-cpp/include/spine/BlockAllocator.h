@@ -87,6 +87,14 @@ namespace spine {
             blocks.add(newBlock(totalSize));
         }
 
+        size_t getNumBlocks() {
+            return blocks.size();
+        }
+
+        Block &getBlock(size_t index) {
+            return blocks[index];
+        }
+
     private:
         void *_allocate(int numBytes) {
             // 16-byte align allocations
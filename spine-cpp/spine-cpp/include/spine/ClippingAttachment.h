@@ -56,9 +56,19 @@ namespace spine {
 
 		virtual Attachment *copy();
 
+		/// Decomposes the polygon of an unweighted clipping attachment into convex, clockwise pieces in attachment space, so
+		/// SkeletonClipping only has to transform them each frame instead of triangulating the world polygon. A second set is
+		/// kept for bones that mirror the attachment. The loaders call this, it must be called again after the vertices or
+		/// bones are changed. Weighted attachments clear the cache.
+		void updateConvexPolygons();
+
 	private:
 		SlotData *_endSlot;
 		Color _color;
+		Vector<float> _convexPolygons, _mirroredConvexPolygons;
+		Vector<int> _convexPolygonLengths, _mirroredConvexPolygonLengths;
+
+		void decompose(bool mirror, Vector<float> &polygons, Vector<int> &lengths);
 	};
 }
 
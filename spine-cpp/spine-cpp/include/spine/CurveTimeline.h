@@ -34,6 +34,8 @@
 #include <spine/Vector.h>
 
 namespace spine {
+	class BezierTable;
+
 	/// Base class for frames that use an interpolation bezier curve.
 	class SP_API CurveTimeline : public Timeline {
 	RTTI_DECL
@@ -43,6 +45,10 @@ namespace spine {
 
 		virtual ~CurveTimeline();
 
+		virtual size_t getFrameCount();
+
+		virtual float getDuration();
+
 		void setLinear(size_t frame);
 
 		void setStepped(size_t frame);
@@ -53,15 +59,80 @@ namespace spine {
 
 		float getBezierValue(float time, size_t frame, size_t valueOffset, size_t i);
 
+		/// Samples each bezier curve at the specified number of uniformly spaced times and stores the values in a lookup
+		/// table. getBezierValue() then interpolates linearly between the two nearest samples instead of searching the
+		/// curve segments. Costs (samples + 1) floats per bezier. Must be called after all frames and beziers are set.
+		/// Timelines with only a time per frame, like DeformTimeline, evaluate their curves separately and are not baked.
+		/// A baked value is off by at most the change of the unbaked value between the two nearest samples, see
+		/// SkeletonJson::setBezierSamples(). A bezier whose control points make time go backward has more than one value
+		/// at some times, the baked values then stay within the curve's range but don't follow the unbaked jumps.
+		/// @param samples 0 discards the lookup table.
+		void bakeBeziers(size_t samples);
+
+		/// The number of samples per bezier in the lookup table, or 0 if the beziers are not baked.
+		size_t getBezierSamples();
+
+		/// Empty for a quantized timeline.
 		Vector<float> &getCurves();
 
+		/// Replaces the frames and curves with 16-bit values to use less memory. Times and values are quantized within
+		/// the range of the timeline's frames and each bezier is stored as a normalized curve in the table, where
+		/// timelines share curves of the same shape. The baked beziers are discarded. Must be called after all frames and
+		/// beziers are set, getFrames() and getCurves() are empty afterward. Only CurveTimeline1 and CurveTimeline2 can
+		/// be quantized.
+		/// @param valueTolerance The largest difference allowed between a value of the quantized timeline and the
+		/// original, checked at the frames and along each curve.
+		/// @param timeTolerance The largest difference in seconds allowed between the time of a quantized frame and the
+		/// original. Times on frames of 30, 60, 120 or 240 frames per second are kept exactly. A frame whose time moved
+		/// also moves its curves, so at a given time a value can differ by more than valueTolerance.
+		/// @return The bytes saved, not counting the curves in the table. 0 if the timeline was not quantized because
+		/// a tolerance would be exceeded, it would not save memory or it is already quantized.
+		virtual size_t quantize(float valueTolerance, float timeTolerance, BezierTable &table);
+
+		/// The bytes quantize() saved, or 0 if the timeline is not quantized.
+		size_t getQuantizedMemorySaved();
+
+		/// True if quantize() replaced the frames, so getFrames() and getCurves() are empty.
+		bool isQuantized() {
+			return _quantized != NULL;
+		}
+
+		/// The time of the first frame, also for a quantized timeline.
+		float getFirstTime() {
+			return _quantized ? _quantized->timeStart : _frames[0];
+		}
+
 	protected:
 		static const int LINEAR = 0;
 		static const int STEPPED = 1;
 		static const int BEZIER = 2;
 		static const int BEZIER_SIZE = 18;
 
+		/// The frames and curves after quantize().
+		struct Quantized : public SpineObject {
+			size_t frameCount;
+			float timeStart, timeScale; // time = timeStart + quantized time * timeScale
+			float valueStart[2], valueScale[2]; // per value of a frame
+			// time, value1, [value2] for each frame, then the curve type for each frame: BEZIER + the index in beziers of the
+			// frame's first bezier
+			Vector<unsigned short> frames;
+			Vector<const short *> beziers; // curve from the BezierTable, NULL for a linear value
+			size_t memorySaved;
+		};
+
 		Vector<float> _curves; // type, x, y, ...
+		Vector<float> _bakedBeziers; // value at each sample, (samples + 1) per bezier
+		size_t _bezierSamples;
+		Quantized *_quantized;
+
+		size_t quantizeFrames(float valueTolerance, float timeTolerance, BezierTable &table);
+
+		/// Finds the index of the last quantized frame at or before the time.
+		size_t searchQuantized(float time);
+
+		/// Interpolates a value of the quantized frames.
+		/// @param value The index of the value within a frame, 0 or 1.
+		float getQuantizedValue(float time, size_t frame, size_t value);
 	};
 
 	class SP_API CurveTimeline1 : public CurveTimeline {
@@ -76,6 +147,8 @@ namespace spine {
 
 		float getCurveValue(float time);
 
+		virtual size_t quantize(float valueTolerance, float timeTolerance, BezierTable &table);
+
         float getRelativeValue(float time, float alpha, MixBlend blend, float current, float setup);
 
         float getAbsoluteValue(float time, float alpha, MixBlend blend, float current, float setup);
@@ -99,7 +172,10 @@ namespace spine {
 
 		void setFrame(size_t frame, float time, float value1, float value2);
 
-		float getCurveValue(float time);
+		/// Interpolates both values at the time, which must be at or after the first frame.
+		void getCurveValue(float time, float &value1, float &value2);
+
+		virtual size_t quantize(float valueTolerance, float timeTolerance, BezierTable &table);
 
 	protected:
 		static const int ENTRIES = 3;
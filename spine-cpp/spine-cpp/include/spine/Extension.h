@@ -43,22 +43,22 @@ namespace spine {
 	public:
 		template<typename T>
 		static T *alloc(size_t num, const char *file, int line) {
-			return (T *) getInstance()->_alloc(sizeof(T) * num, file, line);
+			return (T *) allocBytes(sizeof(T) * num, false, file, line);
 		}
 
 		template<typename T>
 		static T *calloc(size_t num, const char *file, int line) {
-			return (T *) getInstance()->_calloc(sizeof(T) * num, file, line);
+			return (T *) allocBytes(sizeof(T) * num, true, file, line);
 		}
 
 		template<typename T>
 		static T *realloc(T *ptr, size_t num, const char *file, int line) {
-			return (T *) getInstance()->_realloc(ptr, sizeof(T) * num, file, line);
+			return (T *) reallocBytes((void *) ptr, sizeof(T) * num, file, line);
 		}
 
 		template<typename T>
 		static void free(T *ptr, const char *file, int line) {
-			getInstance()->_free((void *) ptr, file, line);
+			freeBytes((void *) ptr, file, line);
 		}
 
 		template<typename T>
@@ -70,6 +70,14 @@ namespace spine {
 			return getInstance()->_readFile(path, length);
 		}
 
+		static const char *mapFile(const String &path, int *length) {
+			return getInstance()->_mapFile(path, length);
+		}
+
+		static void unmapFile(const char *data, int length) {
+			getInstance()->_unmapFile(data, length);
+		}
+
 		static void setInstance(SpineExtension *inSpineExtension);
 
 		static SpineExtension *getInstance();
@@ -88,6 +96,13 @@ namespace spine {
 
 		virtual char *_readFile(const String &path, int *length) = 0;
 
+		/// Maps a file read-only into memory, for data that is only needed while loading. Returns NULL if the file can
+		/// not be mapped, in which case callers fall back to _readFile(). The default implementation returns NULL.
+		virtual const char *_mapFile(const String &path, int *length);
+
+		/// Releases data returned by _mapFile().
+		virtual void _unmapFile(const char *data, int length);
+
 		virtual void _beforeFree(void *ptr) { SP_UNUSED(ptr); }
 
 	protected:
@@ -95,6 +110,13 @@ namespace spine {
 
 	private:
 		static SpineExtension *_instance;
+
+		/// Allocate from the calling thread's current Arena if there is one, see Arena::getCurrent().
+		static void *allocBytes(size_t size, bool clear, const char *file, int line);
+
+		static void *reallocBytes(void *ptr, size_t size, const char *file, int line);
+
+		static void freeBytes(void *ptr, const char *file, int line);
 	};
 
 	class SP_API DefaultSpineExtension : public SpineExtension {
@@ -113,6 +135,10 @@ namespace spine {
 		virtual void _free(void *mem, const char *file, int line) override;
 
 		virtual char *_readFile(const String &path, int *length) override;
+
+		virtual const char *_mapFile(const String &path, int *length) override;
+
+		virtual void _unmapFile(const char *data, int length) override;
 	};
 
 // This function is to be implemented by engine specific runtimes to provide
@@ -32,6 +32,8 @@
 
 #include <spine/Vector.h>
 #include <spine/SpineObject.h>
+#include <spine/SpineString.h>
+#include <spine/StringTable.h>
 
 // Required for new with line number and file name in MSVC
 #ifdef _MSC_VER
@@ -42,10 +44,90 @@
 #endif
 
 namespace spine {
+	/// Computes hashes for HashMap keys. Integral, pointer and String keys are supported out of the box,
+	/// any other key type must provide a <code>size_t hash() const</code> method consistent with its operator==.
+	template<typename K>
+	struct HashMapHash {
+		static size_t hash(const K &key) {
+			return key.hash();
+		}
+	};
+
+	/// 64-bit finalizer (splitmix64) so that keys which only differ in their upper bits, like PropertyId, spread
+	/// across all buckets.
+	inline size_t hashMapMix(unsigned long long value) {
+		value ^= value >> 30;
+		value *= 0xbf58476d1ce4e5b9ULL;
+		value ^= value >> 27;
+		value *= 0x94d049bb133111ebULL;
+		value ^= value >> 31;
+		return (size_t) value;
+	}
+
+	/// FNV-1a over the characters of a string.
+	inline size_t hashMapString(const char *chars, size_t length) {
+		unsigned long long hash = 14695981039346656037ULL;
+		for (size_t i = 0; i < length; i++) {
+			hash ^= (unsigned char) chars[i];
+			hash *= 1099511628211ULL;
+		}
+		return (size_t) hash;
+	}
+
+	template<typename K>
+	struct HashMapHash<K *> {
+		static size_t hash(K *key) {
+			return hashMapMix((unsigned long long) (size_t) key);
+		}
+	};
+
+	template<>
+	struct HashMapHash<int> {
+		static size_t hash(int key) { return hashMapMix((unsigned long long) key); }
+	};
+
+	template<>
+	struct HashMapHash<unsigned int> {
+		static size_t hash(unsigned int key) { return hashMapMix((unsigned long long) key); }
+	};
+
+	template<>
+	struct HashMapHash<long> {
+		static size_t hash(long key) { return hashMapMix((unsigned long long) key); }
+	};
+
+	template<>
+	struct HashMapHash<unsigned long> {
+		static size_t hash(unsigned long key) { return hashMapMix((unsigned long long) key); }
+	};
+
+	template<>
+	struct HashMapHash<long long> {
+		static size_t hash(long long key) { return hashMapMix((unsigned long long) key); }
+	};
+
+	template<>
+	struct HashMapHash<unsigned long long> {
+		static size_t hash(unsigned long long key) { return hashMapMix(key); }
+	};
+
+	template<>
+	struct HashMapHash<String> {
+		static size_t hash(const String &key) {
+			return key.isInterned() ? StringTable::getHash(key) : hashMapString(key.buffer(), key.length());
+		}
+	};
+
+	/// Open addressing hash map with linear probing. Entries are stored inline in a single power of two sized
+	/// array, removal uses backward shifting so no tombstones are needed. clear() keeps the allocated capacity.
 	template<typename K, typename V>
 	class SP_API HashMap : public SpineObject {
 	private:
-		class Entry;
+		struct Entry {
+			K _key;
+			V _value;
+			size_t _hash;
+		};
 
 	public:
 		class SP_API Pair {
@@ -60,47 +142,54 @@ namespace spine {
 		public:
 			friend class HashMap;
 
-			explicit Entries(Entry *entry) : _entry(NULL), _hasChecked(false) {
-				_start.next = entry;
-				_entry = &_start;
-			}
-
 			Pair next() {
-				assert(_entry);
 				assert(_hasChecked);
-				_entry = _entry->next;
-				Pair pair(_entry->_key, _entry->_value);
+				assert(_index < _capacity && _used[_index]);
+				Entry &entry = _entries[_index++];
+				Pair pair(entry._key, entry._value);
 				_hasChecked = false;
 				return pair;
 			}
 
 			bool hasNext() {
 				_hasChecked = true;
-				return _entry->next;
+				while (_index < _capacity && !_used[_index]) _index++;
+				return _index < _capacity;
 			}
 
 		private:
+			explicit Entries(Entry *entries, bool *used, size_t capacity) : _entries(entries), _used(used), _capacity(capacity), _index(0), _hasChecked(false) {
+			}
+
+			Entry *_entries;
+			bool *_used;
+			size_t _capacity;
+			size_t _index;
 			bool _hasChecked;
-			Entry _start;
-			Entry *_entry;
 		};
 
 		HashMap() :
-				_head(NULL),
+				_entries(NULL),
+				_used(NULL),
+				_capacity(0),
 				_size(0) {
 		}
 
 		~HashMap() {
 			clear();
+			if (_entries) {
+				SpineExtension::free(_entries, __FILE__, __LINE__);
+				SpineExtension::free(_used, __FILE__, __LINE__);
+			}
 		}
 
 		void clear() {
-			for (Entry *entry = _head; entry != NULL;) {
-				Entry *next = entry->next;
-				delete entry;
-				entry = next;
+			if (_size == 0) return;
+			for (size_t i = 0; i < _capacity; i++) {
+				if (!_used[i]) continue;
+				destroy(_entries + i);
+				_used[i] = false;
 			}
-			_head = NULL;
 			_size = 0;
 		}
 
@@ -109,26 +198,20 @@ namespace spine {
 		}
 
 		void put(const K &key, const V &value) {
-			Entry *entry = find(key);
-			if (entry) {
-				entry->_key = key;
-				entry->_value = value;
-			} else {
-				entry = new(__FILE__, __LINE__) Entry();
-				entry->_key = key;
-				entry->_value = value;
-
-				Entry *oldHead = _head;
-
-				if (oldHead) {
-					_head = entry;
-					oldHead->prev = entry;
-					entry->next = oldHead;
-				} else {
-					_head = entry;
-				}
-				_size++;
+			size_t hash = HashMapHash<K>::hash(key);
+			int index = find(key, hash);
+			if (index != -1) {
+				_entries[index]._key = key;
+				_entries[index]._value = value;
+				return;
 			}
+			if ((_size + 1) * 4 > _capacity * 3) grow();
+			size_t mask = _capacity - 1;
+			size_t i = hash & mask;
+			while (_used[i]) i = (i + 1) & mask;
+			construct(_entries + i, key, value, hash);
+			_used[i] = true;
+			_size++;
 		}
 
 		bool addAll(Vector <K> &keys, const V &value) {
@@ -140,29 +223,34 @@ namespace spine {
 		}
 
 		bool containsKey(const K &key) {
-			return find(key) != NULL;
+			return find(key, HashMapHash<K>::hash(key)) != -1;
 		}
 
 		bool remove(const K &key) {
-			Entry *entry = find(key);
-			if (!entry) return false;
-
-			Entry *prev = entry->prev;
-			Entry *next = entry->next;
-
-			if (prev) prev->next = next;
-			else _head = next;
-			if (next) next->prev = entry->prev;
-
-			delete entry;
+			int found = find(key, HashMapHash<K>::hash(key));
+			if (found == -1) return false;
+
+			// Shift following entries of the probe sequence back so lookups never stop at the freed slot.
+			size_t mask = _capacity - 1;
+			size_t hole = (size_t) found;
+			destroy(_entries + hole);
+			_used[hole] = false;
+			for (size_t i = (hole + 1) & mask; _used[i]; i = (i + 1) & mask) {
+				size_t home = _entries[i]._hash & mask;
+				if (((i - home) & mask) < ((i - hole) & mask)) continue;
+				construct(_entries + hole, _entries[i]._key, _entries[i]._value, _entries[i]._hash);
+				_used[hole] = true;
+				destroy(_entries + i);
+				_used[i] = false;
+				hole = i;
+			}
 			_size--;
-
 			return true;
 		}
 
 		V operator[](const K &key) {
-			Entry *entry = find(key);
-			if (entry) return entry->_value;
+			int index = find(key, HashMapHash<K>::hash(key));
+			if (index != -1) return _entries[index]._value;
 			else {
 				assert(false);
 				return 0;
@@ -170,29 +258,60 @@ namespace spine {
 		}
 
 		Entries getEntries() const {
-			return Entries(_head);
+			return Entries(_entries, _used, _capacity);
 		}
 
 	private:
-		Entry *find(const K &key) {
-			for (Entry *entry = _head; entry != NULL; entry = entry->next) {
-				if (entry->_key == key)
-					return entry;
+		int find(const K &key, size_t hash) {
+			if (_size == 0) return -1;
+			size_t mask = _capacity - 1;
+			for (size_t i = hash & mask; _used[i]; i = (i + 1) & mask) {
+				Entry &entry = _entries[i];
+				if (entry._hash == hash && entry._key == key) return (int) i;
 			}
-			return NULL;
+			return -1;
 		}
 
-		class SP_API Entry : public SpineObject {
-		public:
-			K _key;
-			V _value;
-			Entry *next;
-			Entry *prev;
+		void grow() {
+			Entry *oldEntries = _entries;
+			bool *oldUsed = _used;
+			size_t oldCapacity = _capacity;
+
+			_capacity = oldCapacity == 0 ? 16 : oldCapacity << 1;
+			_entries = SpineExtension::alloc<Entry>(_capacity, __FILE__, __LINE__);
+			_used = SpineExtension::calloc<bool>(_capacity, __FILE__, __LINE__);
+
+			size_t mask = _capacity - 1;
+			for (size_t i = 0; i < oldCapacity; i++) {
+				if (!oldUsed[i]) continue;
+				Entry &entry = oldEntries[i];
+				size_t index = entry._hash & mask;
+				while (_used[index]) index = (index + 1) & mask;
+				construct(_entries + index, entry._key, entry._value, entry._hash);
+				_used[index] = true;
+				destroy(oldEntries + i);
+			}
 
-			Entry() : next(NULL), prev(NULL) {}
-		};
+			if (oldEntries) {
+				SpineExtension::free(oldEntries, __FILE__, __LINE__);
+				SpineExtension::free(oldUsed, __FILE__, __LINE__);
+			}
+		}
+
+		static void construct(Entry *entry, const K &key, const V &value, size_t hash) {
+			new(&entry->_key) K(key);
+			new(&entry->_value) V(value);
+			entry->_hash = hash;
+		}
+
+		static void destroy(Entry *entry) {
+			entry->_key.~K();
+			entry->_value.~V();
+		}
 
-		Entry *_head;
+		Entry *_entries;
+		bool *_used;
+		size_t _capacity;
 		size_t _size;
 	};
 }
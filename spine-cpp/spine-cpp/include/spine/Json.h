@@ -38,6 +38,8 @@
 #endif
 
 namespace spine {
+	class Arena;
+
 	class SP_API Json : public SpineObject {
 		friend class SkeletonJson;
 
@@ -51,7 +53,8 @@ namespace spine {
 		static const int JSON_ARRAY;
 		static const int JSON_OBJECT;
 
-		/* Get item "string" from object. Case insensitive. */
+		/* Get item "string" from object. Case insensitive. Returns the first match, the tree is not modified, so several
+		 * threads can read it at once. */
 		static Json *getItem(Json *object, const char *string);
 
 		static Json *getItem(Json *object, int childIndex);
@@ -64,18 +67,17 @@ namespace spine {
 
 		static bool getBoolean(Json *object, const char *name, bool defaultValue);
 
-		/* For analysing failed parses. This returns a pointer to the parse error. You'll probably need to look a few chars back to make sense of it. Defined when Json_create() returns 0. 0 when Json_create() succeeds. */
+		/* For analysing failed parses. This returns a pointer to the parse error. You'll probably need to look a few chars back to make sense of it. Defined when Json_create() returns 0. 0 when Json_create() succeeds. The error is tracked per thread. */
 		static const char *getError();
 
-		/* Supply a block of JSON, and this returns a Json object you can interrogate. Call Json_dispose when finished. */
+		/* Supply a block of JSON, and this returns a Json object you can interrogate. Call Json_dispose when finished. All
+		 * items and strings of the tree are allocated from an Arena owned by the returned object. */
 		explicit Json(const char *value);
 
 		~Json();
 
 
 	private:
-		static const char *_error;
-
 		Json *_next;
 #if SPINE_JSON_HAVE_PREV
 		Json* _prev; /* next/prev allow you to walk array/object chains. Alternatively, use getSize/getItem */
@@ -91,6 +93,8 @@ namespace spine {
 
 		const char *_name; /* The item's name string, if this item is the child of, or is in the list of subitems of an object. */
 
+		Arena *_arena; /* Owns all items and strings of the tree, set on the root only. */
+
 		/* Utility to jump whitespace and cr/lf */
 		static const char *skip(const char *inValue);
 
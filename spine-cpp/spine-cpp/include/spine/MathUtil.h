@@ -62,18 +62,33 @@ namespace spine {
 
 		static float abs(float v);
 
-		/// Returns the sine in radians from a lookup table.
+		/// Returns the sine in radians. Computed by the standard library, unless SPINE_FAST_TRIG is defined, see sinCos().
 		static float sin(float radians);
 
-		/// Returns the cosine in radians from a lookup table.
+		/// Returns the cosine in radians, see sin().
 		static float cos(float radians);
 
-		/// Returns the sine in radians from a lookup table.
+		/// Returns the sine in degrees, see sin().
 		static float sinDeg(float degrees);
 
-		/// Returns the cosine in radians from a lookup table.
+		/// Returns the cosine in degrees, see sin().
 		static float cosDeg(float degrees);
 
+		/// Computes the sine and cosine in radians together, with the same results as sin() and cos().
+		///
+		/// By default the standard library's sin and cos are called with the float angle, as before, which selects their
+		/// float overloads where <math.h> declares them. If SPINE_FLOAT_TRIG is defined, sinf and cosf are called
+		/// explicitly. If SPINE_FAST_TRIG is defined, a polynomial approximation is used
+		/// with an absolute error below 8e-8 for angles up to 1000 radians in magnitude and below 1e-6 up to 10^5
+		/// radians. Larger angles lose precision, and beyond 4 * 10^6 radians the results are meaningless.
+		static void sinCos(float radians, float &outSin, float &outCos);
+
+		/// Computes sinCos() for count angles. With SPINE_FAST_TRIG, 4 angles are computed at once using SSE or NEON,
+		/// unless SPINE_NO_SIMD is defined.
+		/// @param outSin May be the same as radians.
+		/// @param outCos May be the same as radians.
+		static void sinCos(const float *radians, float *outSin, float *outCos, size_t count);
+
 		/// Returns atan2 in radians, faster but less accurate than Math.Atan2. Average error of 0.00231 radians (0.1323
 		/// degrees), largest error of 0.00488 radians (0.2796 degrees).
 		static float atan2(float y, float x);
@@ -97,6 +112,8 @@ namespace spine {
 		static float pow(float a, float b);
 
         static float ceil(float v);
+
+		static float floor(float v);
 	};
 
 	struct SP_API Interpolation {
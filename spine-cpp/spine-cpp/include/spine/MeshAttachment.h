@@ -60,6 +60,17 @@ namespace spine {
 
 		void updateRegion();
 
+		/// Computes the local bounds used by Skeleton::getConservativeBounds(). Must be called after the vertices or
+		/// bones are changed. The skeleton loaders call it.
+		void updateBounds();
+
+		/// The skeleton bone indices of the bounds, or empty if the mesh is not weighted. See getBounds().
+		Vector<int> &getBoundsBones();
+
+		/// The minimum x, minimum y, maximum x and maximum y of the vertices in the local space of each bone in
+		/// getBoundsBones(), or of the slot's bone if the mesh is not weighted. Empty if updateBounds() was not called.
+		Vector<float> &getBounds();
+
 		int getHullLength();
 
 		void setHullLength(int inValue);
@@ -110,6 +121,8 @@ namespace spine {
 		Vector<float> _regionUVs;
 		Vector<unsigned short> _triangles;
 		Vector<unsigned short> _edges;
+		Vector<int> _boundsBones;
+		Vector<float> _bounds;
 		String _path;
 		Color _color;
 		int _hullLength;
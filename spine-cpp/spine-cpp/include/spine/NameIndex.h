@@ -0,0 +1,88 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_NameIndex_h
+#define Spine_NameIndex_h
+
+#include <spine/ContainerUtil.h>
+#include <spine/HashMap.h>
+
+namespace spine {
+	/// Hashed lookup of items by name, built once for a vector of named items such as SkeletonData::getBones().
+	/// The index only stores item indices, lookups do not allocate and can be performed concurrently once built.
+	/// If the vector's size no longer matches the size the index was built for, lookups fall back to a linear scan.
+	class SP_API NameIndex : public SpineObject {
+	public:
+		NameIndex() : _count(0) {
+		}
+
+		/// Rebuilds the index for the given items. Call again after items were added or removed.
+		template<typename T>
+		void build(Vector<T *> &items) {
+			_count = items.size();
+			_hashes.setSize(_count, 0);
+			size_t capacity = 16;
+			while (capacity < _count * 2) capacity <<= 1;
+			_table.setSize(capacity, 0);
+			for (size_t i = 0; i < capacity; i++) _table[i] = 0;
+
+			size_t mask = capacity - 1;
+			for (size_t i = 0; i < _count; i++) {
+				const String &name = items[i]->getName();
+				size_t hash = HashMapHash<String>::hash(name);
+				_hashes[i] = hash;
+				size_t slot = hash & mask;
+				while (_table[slot] != 0) slot = (slot + 1) & mask;
+				_table[slot] = (int) i + 1;
+			}
+		}
+
+		/// @return -1 if no item with the name was found. If several items share a name, the first one is returned.
+		template<typename T>
+		int find(Vector<T *> &items, const String &name) {
+			if (_count == 0 || _count != items.size()) return ContainerUtil::findIndexWithName(items, name);
+			assert(name.length() > 0);
+
+			size_t hash = HashMapHash<String>::hash(name);
+			size_t mask = _table.size() - 1;
+			for (size_t slot = hash & mask; _table[slot] != 0; slot = (slot + 1) & mask) {
+				int index = _table[slot] - 1;
+				if (_hashes[index] == hash && items[index]->getName() == name) return index;
+			}
+			return -1;
+		}
+
+	private:
+		Vector<int> _table;
+		Vector<size_t> _hashes;
+		size_t _count;
+	};
+}
+
+#endif /* Spine_NameIndex_h */
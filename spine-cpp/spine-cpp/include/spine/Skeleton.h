@@ -60,6 +60,8 @@ namespace spine {
 
     class SkeletonClipping;
 
+	class UpdateCacheTemplate;
+
 	class SP_API Skeleton : public SpineObject {
 		friend class AnimationState;
 
@@ -124,6 +126,11 @@ namespace spine {
 
 		/// Caches information about bones and constraints. Must be called if bones, constraints or weighted path attachments are added
 		/// or removed.
+		///
+		/// The result is kept by the skeleton data and copied by later calls from any skeleton of the data for a skin with the
+		/// same bones, constraints and path attachments for path constraint target slots, as long as the attachments of
+		/// those slots are also the same. Weighted path attachments of the data's skins must not be changed once skeletons
+		/// were created.
 		void updateCache();
 
 		void printUpdateCache();
@@ -136,9 +143,24 @@ namespace spine {
 
 		void updateWorldTransform(Physics physics, Bone *parent);
 
+		/// If true, updateWorldTransform(Physics) updates consecutive bones of the update cache as a batch. Their local
+		/// matrices are computed into a structure of arrays pose buffer owned by the skeleton first, then bones with
+		/// Inherit_Normal whose parents are already updated are combined with their parent 4 at a time using SSE or NEON
+		/// where available. Results are identical to the per bone path unless the compiler contracts multiply-adds into
+		/// fused instructions for only one of the paths. It mainly pays off with SPINE_FAST_TRIG, which computes the angles
+		/// of a run 4 at a time; with the default trig backend it can be slower than the per bone path, see
+		/// spine-cpp/tests/BoneUpdateBenchmark.cpp. Default is false.
+		void setUsePoseBuffer(bool usePoseBuffer);
+
+		bool getUsePoseBuffer();
+
 		/// Sets the bones, constraints, and slots to their setup pose values.
 		void setToSetupPose();
 
+		/// Restores the state of a newly constructed skeleton without reallocating its bones, slots and constraints: no
+		/// skin, the setup pose, default color, position, scale and time, and reset physics. Used by SkeletonPool.
+		void reset();
+
 		/// Sets the bones and constraints to their setup pose values.
 		void setBonesToSetupPose();
 
@@ -168,6 +190,13 @@ namespace spine {
 		/// @return May be NULL.
 		Attachment *getAttachment(int slotIndex, const String &attachmentName);
 
+		/// Returns the same attachment as getAttachment(int, const String &) for a name interned by
+		/// SkeletonData::updateAttachmentIds(), without comparing names. The resolved attachments of every slot are cached
+		/// and rebuilt when the skin changes, or when the skin, the default skin or the ids were modified.
+		/// @param attachmentId A valid id for the slot, see SlotData and AttachmentTimeline::getAttachmentIds().
+		/// @return May be NULL.
+		Attachment *getAttachmentById(int slotIndex, int attachmentId);
+
 		/// @param attachmentName May be empty.
 		void setAttachment(const String &slotName, const String &attachmentName);
 
@@ -193,6 +222,12 @@ namespace spine {
         void getBounds(float &outX, float &outY, float &outWidth, float &outHeight, Vector<float> &outVertexBuffer);
 		void getBounds(float &outX, float &outY, float &outWidth, float &outHeight, Vector<float> &outVertexBuffer, SkeletonClipping *clipper);
 
+		/// Returns an AABB that contains the region and mesh attachments for the current pose, without allocating. Meshes
+		/// use the local bounds from MeshAttachment::updateBounds() transformed by their bones, so the AABB may be larger
+		/// than the one from getBounds(). Deformed meshes and meshes without local bounds are computed exactly. Clipping
+		/// is ignored. Suited for culling.
+		void getConservativeBounds(float &outX, float &outY, float &outWidth, float &outHeight);
+
 		Bone *getRootBone();
 
 		SkeletonData *getData();
@@ -250,6 +285,7 @@ namespace spine {
 
 	private:
 		SkeletonData *_data;
+		char *_memory; // Holds the bones, slots and constraints.
 		Vector<Bone *> _bones;
 		Vector<Slot *> _slots;
 		Vector<Slot *> _drawOrder;
@@ -258,11 +294,21 @@ namespace spine {
 		Vector<PathConstraint *> _pathConstraints;
         Vector<PhysicsConstraint *> _physicsConstraints;
 		Vector<Updatable *> _updateCache;
+		Vector<Updatable *> _constraintOrder; // The constraints by their order, NULL for an unused order.
+		Vector<int> _skinKey;
+		Vector<int> _boneRunEnds; // For each update cache index, the end of the run of bones starting there, or 0.
+		Vector<float> _poseBuffer;
+		bool _usePoseBuffer;
 		Skin *_skin;
 		Color _color;
 		float _scaleX, _scaleY;
 		float _x, _y;
         float _time;
+		Vector<Attachment *> _attachmentCache; // The attachments for each slot's attachment ids.
+		Vector<size_t> _attachmentCacheOffsets; // Index of each slot's first id in the cache.
+		Skin *_attachmentCacheSkin;
+		Skin *_attachmentCacheDefaultSkin;
+		size_t _attachmentCacheVersion;
 
 		void sortIkConstraint(IkConstraint *constraint);
 
@@ -278,7 +324,23 @@ namespace spine {
 
 		void sortBone(Bone *bone);
 
+		/// Sets the skin key to what the update cache depends on in the skin: the sorted indices of its bones and -1 - the
+		/// orders of its constraints, preceded by their count, followed by the bones of each path attachment for the
+		/// target slot of each path constraint.
+		void updateSkinKey();
+
+		/// Copies the update cache from the template if it matches the skeleton's path constraint target attachments.
+		bool setUpdateCache(UpdateCacheTemplate &updateCacheTemplate);
+
+		UpdateCacheTemplate *newUpdateCacheTemplate();
+
 		static void sortReset(Vector<Bone *> &bones);
+
+		void updateBoneRun(size_t start, size_t end, Physics physics);
+
+		size_t getAttachmentCacheVersion();
+
+		void updateAttachmentCache();
 	};
 }
 
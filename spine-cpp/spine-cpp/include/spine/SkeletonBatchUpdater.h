@@ -0,0 +1,127 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SkeletonBatchUpdater_h
+#define Spine_SkeletonBatchUpdater_h
+
+#include <spine/Physics.h>
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	class AnimationState;
+
+	class Skeleton;
+
+	class SkeletonData;
+
+	class SkeletonRenderer;
+
+	class TaskRunner;
+
+	struct RenderCommand;
+
+	/// Updates many independent skeleton instances per frame, optionally in parallel through a TaskRunner such as
+	/// ThreadPoolTaskRunner.
+	///
+	/// Thread safety: instances are updated concurrently, each instance only by one thread at a time. This is safe as
+	/// long as instances do not share a Skeleton or AnimationState. Instances may share SkeletonData and
+	/// AnimationStateData, which are only read during updates, so they must not be modified while update() runs.
+	/// The SpineExtension must be thread-safe, which DefaultSpineExtension is and DebugExtension is not. Its instance
+	/// must have been created before the first update, which is the case once skeleton data was loaded.
+	/// AnimationState listeners are called on the thread that updates the instance.
+	/// Region and mesh attachments with a Sequence change their shared region when rendered, so instances whose
+	/// SkeletonData has sequence attachments are rendered on the calling thread after the parallel update.
+	class SP_API SkeletonBatchUpdater : public SpineObject {
+	public:
+		/// @param taskRunner Runs the update tasks. If NULL, instances are updated on the calling thread.
+		/// @param ownsTaskRunner If true, the task runner is deleted with the updater.
+		explicit SkeletonBatchUpdater(TaskRunner *taskRunner = NULL, bool ownsTaskRunner = false);
+
+		~SkeletonBatchUpdater();
+
+		/// Adds an instance. The animation state and skeleton are not owned by the updater.
+		/// @param state May be NULL to only pose the skeleton.
+		/// @param delta The time in seconds the instance advances per update(), see setDelta().
+		/// @param renderer Renders the instance if rendering is enabled. It is not owned by the updater. If NULL, the
+		/// updater creates one.
+		/// @return The index of the instance.
+		size_t add(AnimationState *state, Skeleton *skeleton, float delta = 0, SkeletonRenderer *renderer = NULL);
+
+		/// Sets the time in seconds the instance advances on the next update().
+		void setDelta(size_t index, float delta);
+
+		/// Removes all instances.
+		void clear();
+
+		size_t size();
+
+		/// If true, update() also renders each skeleton with a SkeletonRenderer owned by the updater. Default is false.
+		void setRender(bool render);
+
+		bool getRender();
+
+		/// The number of instances updated by one task. Default is 16.
+		void setBatchSize(size_t batchSize);
+
+		/// For each instance, calls AnimationState::update(delta), AnimationState::apply(), Skeleton::update(delta) and
+		/// Skeleton::updateWorldTransform(physics), then renders the skeleton if enabled.
+		void update(Physics physics);
+
+		/// The render commands of an instance produced by the last update(), valid until the next update().
+		/// @return NULL if rendering is disabled or the skeleton has nothing to render.
+		RenderCommand *getRenderCommands(size_t index);
+
+	private:
+		struct Instance {
+			AnimationState *state;
+			Skeleton *skeleton;
+			float delta;
+			SkeletonRenderer *renderer;
+			RenderCommand *renderCommands;
+			bool ownsRenderer;
+			bool serialRender;
+		};
+
+		TaskRunner *_taskRunner;
+		bool _ownsTaskRunner;
+		Vector<Instance> _instances;
+		bool _render;
+		size_t _batchSize;
+		Physics _physics;
+
+		static void updateBatch(void *context, size_t index);
+
+		void updateInstance(Instance &instance, bool render);
+
+		static bool hasSequences(SkeletonData *data);
+	};
+}
+
+#endif /* Spine_SkeletonBatchUpdater_h */
@@ -63,6 +63,8 @@ namespace spine {
 
 	class Sequence;
 
+	class TaskRunner;
+
 	class SP_API SkeletonBinary : public SpineObject {
 	public:
 		static const int BONE_ROTATE = 0;
@@ -112,29 +114,79 @@ namespace spine {
 
 		SkeletonData *readSkeletonData(const unsigned char *binary, int length);
 
+		/// Reads the file through SpineExtension::mapFile() if the extension can map files, otherwise through
+		/// SpineExtension::readFile().
 		SkeletonData *readSkeletonDataFile(const String &path);
 
 		void setScale(float scale) { _scale = scale; }
 
+		/// If > 0, the bezier curves of loaded timelines are baked into lookup tables with this many samples per curve,
+		/// trading memory for faster curve evaluation. See CurveTimeline::bakeBeziers(). Default is 0.
+		///
+		/// A baked value is off by at most the change of the curve's value within 1 / samples of the frame's duration,
+		/// so steep curves need more samples. For the beziers of the example animations, the largest difference is
+		/// 34% of the curve's range of values with 8 samples, 21% with 16, 13% with 32 and 4% with 64, while most differ
+		/// by less than 1% with 16 samples. See tests/BezierBakeTest.cpp.
+		void setBezierSamples(size_t samples) { _bezierSamples = samples; }
+
+		/// If true, everything belonging to loaded skeleton data is allocated from a single Arena owned by the data, see
+		/// SkeletonData::getArena(). Loading does fewer, larger allocations and deleting the data releases its memory at
+		/// once. Attachments are only allocated from the arena when loading with an atlas. An AttachmentLoader passed to
+		/// the constructor is called without an arena, so it can allocate memory it frees itself. Default is false.
+		void setUseArena(bool useArena) { _useArena = useArena; }
+
+		/// If not NULL, animations are read as tasks on the runner after the rest of the skeleton data, possibly
+		/// concurrently. The animations are found by first skipping over them, which is fast compared to reading them.
+		/// The SpineExtension must be thread-safe, see SkeletonBatchUpdater. Default is NULL, reading animations on the
+		/// calling thread.
+		void setTaskRunner(TaskRunner *taskRunner) { _taskRunner = taskRunner; }
+
+		/// If true, the timelines of animations are not decoded when loading. The encoded animations are kept by the
+		/// skeleton data, which decodes an animation when it is first used by AnimationState or passed to
+		/// SkeletonData::loadAnimation(), and can unload animations again to stay within a memory budget, see
+		/// SkeletonData::setAnimationMemoryBudget(). Animations that are applied directly with Animation::apply() must be
+		/// loaded first, see Animation::isLoaded(). AnimationStates using such animations must be deleted before the
+		/// skeleton data. Decoded animations are not allocated from the data's arena. Default is false.
+		void setLazyAnimations(bool lazyAnimations) { _lazyAnimations = lazyAnimations; }
+
 		String &getError() { return _error; }
 
 	private:
+		friend class SkeletonData;
+
 		struct DataInput : public SpineObject {
 			const unsigned char *cursor;
 			const unsigned char *end;
 		};
 
+		struct AnimationTask;
+
 		AttachmentLoader *_attachmentLoader;
 		Vector<LinkedMesh *> _linkedMeshes;
 		String _error;
 		float _scale;
+		size_t _bezierSamples;
+		bool _useArena;
+		TaskRunner *_taskRunner;
+		bool _lazyAnimations;
 		const bool _ownsLoader;
+		const bool _atlasLoader; // The loader is the AtlasAttachmentLoader created for an atlas, see setUseArena().
+		Vector<unsigned char> _animationData; // The encoded animations, for a loader that decodes lazily read animations.
+
+		/// Creates a loader that decodes lazily read animations, see setLazyAnimations().
+		SkeletonBinary(float scale, size_t bezierSamples);
 
 		void setError(const char *value1, const char *value2);
 
+		SkeletonData *parseSkeletonData(const unsigned char *binary, int length);
+
 		char *readString(DataInput *input);
 
-		char *readStringRef(DataInput *input, SkeletonData *skeletonData);
+		/// Reads a string and interns it, see StringTable.
+		String readInternedString(DataInput *input);
+
+		/// @return An interned string from the skeleton data's string table, empty for index 0.
+		const String &readStringRef(DataInput *input, SkeletonData *skeletonData);
 
 		float readFloat(DataInput *input);
 
@@ -165,6 +217,18 @@ namespace spine {
 
 		Animation *readAnimation(const String &name, DataInput *input, SkeletonData *skeletonData);
 
+		int readAnimations(DataInput *input, SkeletonData *skeletonData, int animationsCount);
+
+		static void readAnimationTask(void *context, size_t index);
+
+		bool skipAnimation(DataInput *input, SkeletonData *skeletonData, float &duration, Vector<int> *attachmentKeys);
+
+		int readLazyAnimations(DataInput *input, SkeletonData *skeletonData, int animationsCount, Vector<int> &attachmentKeys);
+
+		bool readLazyAnimation(Animation *animation, SkeletonData *skeletonData);
+
+		void skipCurveFrames(DataInput *input, int frameCount, int frameSize, int curves, float &duration);
+
 		void
 		setBezier(DataInput *input, CurveTimeline *timeline, int bezier, int frame, int value, float time1, float time2,
 				  float value1, float value2, float scale);
@@ -37,20 +37,26 @@
 namespace spine {
 	class Skeleton;
 
+	class Slot;
+
 	class BoundingBoxAttachment;
 
 	class Polygon;
 
 	/// Collects each BoundingBoxAttachment that is visible and computes the world vertices for its polygon.
 	/// The polygon vertices are provided along with convenience methods for doing hit detection.
+	///
+	/// Polygons are kept between updates. A polygon's world vertices are only recomputed if its slot, attachment or
+	/// bone world transform changed, or if the attachment is weighted or deformed. See SkeletonBoundsGrid to query many
+	/// skeletons at once.
 	class SP_API SkeletonBounds : public SpineObject {
 	public:
 		SkeletonBounds();
 
 		~SkeletonBounds();
 
-		/// Clears any previous polygons, finds all visible bounding box attachments,
-		/// and computes the world vertices for each bounding box's polygon.
+		/// Finds all visible bounding box attachments and computes the world vertices for each bounding box's polygon
+		/// that changed since the last update.
 		/// @param skeleton The skeleton.
 		/// @param updateAabb
 		/// If true, the axis aligned bounding box containing all the polygons is computed.
@@ -65,7 +71,7 @@ namespace spine {
 		bool aabbintersectsSegment(float x1, float y1, float x2, float y2);
 
 		/// Returns true if the axis aligned bounding box intersects the axis aligned bounding box of the specified bounds.
-		bool aabbIntersectsSkeleton(SkeletonBounds bounds);
+		bool aabbIntersectsSkeleton(SkeletonBounds &bounds);
 
 		/// Returns true if the polygon contains the point.
 		bool containsPoint(Polygon *polygon, float x, float y);
@@ -98,11 +104,24 @@ namespace spine {
 
 		float getHeight();
 
+		float getMinX();
+
+		float getMinY();
+
+		float getMaxX();
+
+		float getMaxY();
+
 	private:
 		Pool <Polygon> _polygonPool;
 		Vector<BoundingBoxAttachment *> _boundingBoxes;
 		Vector<Polygon *> _polygons;
+		Vector<Slot *> _slots;
+		Vector<float> _boneTransforms;
 		float _minX, _minY, _maxX, _maxY;
+		bool _aabbValid;
+
+		bool updatePolygon(size_t index, Slot &slot, BoundingBoxAttachment &boundingBox);
 
 		void aabbCompute();
 	};
@@ -111,8 +130,10 @@ namespace spine {
 	public:
 		Vector<float> _vertices;
 		int _count;
+		/// The axis aligned bounding box of the vertices, computed by SkeletonBounds::update().
+		float _minX, _minY, _maxX, _maxY;
 
-		Polygon() : _count(0) {
+		Polygon() : _count(0), _minX(0), _minY(0), _maxX(0), _maxY(0) {
 			_vertices.ensureCapacity(16);
 		}
 	};
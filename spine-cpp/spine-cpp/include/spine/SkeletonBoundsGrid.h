@@ -0,0 +1,109 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SkeletonBoundsGrid_h
+#define Spine_SkeletonBoundsGrid_h
+
+#include <spine/Vector.h>
+#include <spine/SpineObject.h>
+
+namespace spine {
+	class SkeletonBounds;
+
+	class BoundingBoxAttachment;
+
+	/// A broad phase for hit detection across many skeletons. Each SkeletonBounds is hashed into the cells of a uniform
+	/// grid that its axis aligned bounding box overlaps, so queries only test the skeletons near the point or segment.
+	/// Bounds spanning many cells are kept in a separate list that every query tests.
+	class SP_API SkeletonBoundsGrid : public SpineObject {
+	public:
+		/// @param cellSize The width and height of a cell in world units. Cells about the size of a skeleton work well.
+		explicit SkeletonBoundsGrid(float cellSize = 256);
+
+		~SkeletonBoundsGrid();
+
+		/// Adds bounds, which are not owned by the grid. The bounds must be updated with updateAabb true.
+		void add(SkeletonBounds *bounds);
+
+		void remove(SkeletonBounds *bounds);
+
+		void clear();
+
+		Vector<SkeletonBounds *> &getBounds();
+
+		/// Rehashes the grid if the AABB of any bounds moved to other cells since the last update. Call after the bounds
+		/// were updated and before querying.
+		void update();
+
+		/// Finds each bounding box that contains the point.
+		/// @param outBounds Set to the bounds of each hit.
+		/// @param outBoundingBoxes Set to the bounding box attachment of each hit.
+		/// @return The number of hits.
+		size_t containsPoint(float x, float y, Vector<SkeletonBounds *> &outBounds, Vector<BoundingBoxAttachment *> &outBoundingBoxes);
+
+		/// Finds each bounding box that intersects the line segment.
+		/// @param outBounds Set to the bounds of each hit.
+		/// @param outBoundingBoxes Set to the bounding box attachment of each hit.
+		/// @return The number of hits.
+		size_t intersectsSegment(float x1, float y1, float x2, float y2, Vector<SkeletonBounds *> &outBounds,
+								 Vector<BoundingBoxAttachment *> &outBoundingBoxes);
+
+		float getCellSize();
+
+	private:
+		float _cellSize;
+		Vector<SkeletonBounds *> _bounds;
+		// Per bounds: the min and max cell x and y, or empty or large markers.
+		Vector<int> _cells;
+		Vector<int> _large;
+		// The entries of bucket i are _entries[_bucketStarts[i]] to _entries[_bucketStarts[i + 1]].
+		Vector<int> _bucketStarts;
+		Vector<int> _entries;
+		Vector<unsigned int> _stamps;
+		unsigned int _stamp;
+		bool _dirty;
+
+		bool computeCells(SkeletonBounds &bounds, int *cells);
+
+		void rehash();
+
+		int cell(float v);
+
+		size_t bucket(int x, int y);
+
+		unsigned int nextStamp();
+
+		void queryPoint(int index, float x, float y, Vector<SkeletonBounds *> &outBounds, Vector<BoundingBoxAttachment *> &outBoundingBoxes);
+
+		void querySegment(int index, float x1, float y1, float x2, float y2, Vector<SkeletonBounds *> &outBounds,
+						  Vector<BoundingBoxAttachment *> &outBoundingBoxes);
+	};
+}
+
+#endif /* Spine_SkeletonBoundsGrid_h */
@@ -32,6 +32,7 @@
 
 #include <spine/Vector.h>
 #include <spine/Triangulator.h>
+#include <spine/Pool.h>
 
 namespace spine {
 	class Slot;
@@ -39,9 +40,13 @@ namespace spine {
 	class ClippingAttachment;
 
 	class SP_API SkeletonClipping : public SpineObject {
+		friend class ClippingAttachment;
+
 	public:
 		SkeletonClipping();
 
+		~SkeletonClipping();
+
 		size_t clipStart(Slot &slot, ClippingAttachment *clip);
 
 		void clipEnd(Slot &slot);
@@ -59,6 +64,13 @@ namespace spine {
 
 		bool isClipping();
 
+		/// If false, every triangle is clipped against every clipping polygon, without first accepting the triangles
+		/// inside a polygon and rejecting those outside it. Only useful for comparing the results and performance of
+		/// both. Default is true.
+		void setClassifyTriangles(bool classifyTriangles);
+
+		bool getClassifyTriangles();
+
 		Vector<float> &getClippedVertices();
 
 		Vector<unsigned short> &getClippedTriangles();
@@ -75,6 +87,19 @@ namespace spine {
 		Vector<float> _scratch;
 		ClippingAttachment *_clipAttachment;
 		Vector<Vector<float> *> *_clippingPolygons;
+		Vector<Vector<float> *> _transformedPolygons;
+		Pool<Vector<float> > _polygonPool;
+		Vector<float> _polygonBounds;
+		Vector<unsigned char> _triangleClasses;
+		bool _classifyTriangles;
+
+		/// Transforms the convex pieces cached by the clipping attachment to world space. Returns false if the attachment has no
+		/// cache, is deformed or its bone is degenerate, in which case the world polygon has to be decomposed.
+		bool transformConvexPolygons(Slot &slot, ClippingAttachment *clip);
+
+		/// Tests each triangle against the bounds and edges of every clipping polygon, 4 triangles at a time where SIMD is
+		/// available, so only triangles straddling a polygon go through clip().
+		void classifyTriangles(float *vertices, unsigned short *triangles, size_t trianglesLength, size_t stride);
 
 		/** Clips the input triangle against the convex, clockwise clipping area. If the triangle lies entirely within the clipping
 		  * area, false is returned. The clipping area must duplicate the first vertex at the end of the vertices list. */
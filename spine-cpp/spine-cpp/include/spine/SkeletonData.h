@@ -32,6 +32,9 @@
 
 #include <spine/Vector.h>
 #include <spine/SpineString.h>
+#include <spine/NameIndex.h>
+#include <spine/Arena.h>
+#include <spine/BezierTable.h>
 
 namespace spine {
 	class BoneData;
@@ -52,6 +55,10 @@ namespace spine {
 
     class PhysicsConstraintData;
 
+	class SkeletonBinary;
+
+	class UpdateCacheTemplate;
+
 /// Stores the setup pose and all of the stateless data for a skeleton.
 	class SP_API SkeletonData : public SpineObject {
 		friend class SkeletonBinary;
@@ -60,13 +67,16 @@ namespace spine {
 
 		friend class Skeleton;
 
+		friend class AnimationState;
+
+		friend class TrackEntry;
+
 	public:
 		SkeletonData();
 
 		~SkeletonData();
 
-		/// Finds a bone by comparing each bone's name.
-		/// It is more efficient to cache the results of this method than to call it multiple times.
+		/// Finds a bone by name using the hashed name index, see updateNameIndex().
 		/// @return May be NULL.
 		BoneData *findBone(const String &boneName);
 
@@ -79,6 +89,7 @@ namespace spine {
 		/// @return May be NULL.
 		spine::EventData *findEvent(const String &eventDataName);
 
+		/// Does not load an animation read with SkeletonBinary::setLazyAnimations(), see loadAnimation().
 		/// @return May be NULL.
 		Animation *findAnimation(const String &animationName);
 
@@ -94,6 +105,62 @@ namespace spine {
         /// @return May be NULL.
         PhysicsConstraintData *findPhysicsConstraint(const String &constraintName);
 
+		/// Rebuilds the hashed name indices used by the find methods. The loaders call this once after loading,
+		/// call it again after adding or removing bones, slots, skins, events, animations or constraints.
+		/// Until then, find methods for a modified list fall back to comparing each item's name.
+		void updateNameIndex();
+
+		/// Interns the setup attachment name of each slot and the names keyed by attachment timelines as ids per slot, so
+		/// AnimationState and AttachmentTimeline can resolve attachments without comparing names, see
+		/// Skeleton::getAttachmentById(). The loaders call this once after loading, call it again after adding
+		/// animations or changing names through AttachmentTimeline::getAttachmentNames(). Names set with
+		/// SlotData::setAttachmentName() or AttachmentTimeline::setFrame() are looked up by name until then.
+		void updateAttachmentIds();
+
+		/// Decodes the timelines of an animation read with SkeletonBinary::setLazyAnimations() if they are not loaded, and
+		/// keeps them loaded until a matching releaseAnimation(). AnimationState does this for each track entry. Afterward,
+		/// loaded animations that are not in use are unloaded, least recently used first, until the loaded animations fit
+		/// the memory budget. Can be called from several threads at once.
+		/// @return False if decoding failed, the animation then has no timelines and releaseAnimation() must not be called.
+		bool loadAnimation(Animation *animation);
+
+		/// Allows the timelines of an animation loaded with loadAnimation() to be unloaded again once no other
+		/// loadAnimation() call or track entry uses them.
+		void releaseAnimation(Animation *animation);
+
+		/// Frees the timelines of an animation read with SkeletonBinary::setLazyAnimations(), unless the animation is in
+		/// use, see loadAnimation(). They are decoded again by the next loadAnimation().
+		void unloadAnimation(Animation *animation);
+
+		/// The approximate memory in bytes that the timelines of lazily read animations may use before loaded animations
+		/// no track entry uses are unloaded. Default is 0, which never unloads animations.
+		void setAnimationMemoryBudget(size_t budget);
+
+		size_t getAnimationMemoryBudget();
+
+		/// The approximate memory in bytes used by the timelines of the loaded, lazily read animations.
+		size_t getAnimationMemory();
+
+		/// Quantizes the CurveTimeline1 and CurveTimeline2 timelines of the animations to use less memory, see
+		/// CurveTimeline::quantize(). The timelines share their curves through a table owned by the skeleton data.
+		/// Animations read with SkeletonBinary::setLazyAnimations() that are not loaded are quantized when they are
+		/// loaded. Must not be called while the animations are applied. For data loaded into an arena, the memory of
+		/// the original frames is only released when the data is deleted.
+		/// @param valueTolerance The largest difference allowed for a value, eg in degrees for rotation.
+		/// @param timeTolerance The largest difference in seconds allowed for the time of a frame.
+		/// @return The bytes saved, less the bytes used for new shared curves.
+		size_t quantizeTimelines(float valueTolerance, float timeTolerance);
+
+		/// The bytes saved by quantizing the timelines of the loaded animations, less the bytes used for the shared
+		/// curves, see quantizeTimelines().
+		size_t getQuantizedMemorySaved();
+
+		/// The arena the data was loaded into, see SkeletonJson::setUseArena(). Memory allocated from the arena is only
+		/// released when the skeleton data is deleted. Changes to the data after loading allocate from the heap, unless
+		/// made within an ArenaScope for the arena.
+		/// @return May be NULL.
+		Arena *getArena();
+
 		const String &getName();
 
 		void setName(const String &inValue);
@@ -168,6 +235,29 @@ namespace spine {
 		void setFps(float inValue);
 
 	private:
+		static int internAttachmentName(SlotData &slot, const String &name);
+
+		/// Like internAttachmentName(), but only finds names already interned, returning -1 otherwise.
+		static int findAttachmentId(SlotData &slot, const String &name);
+
+		bool loadLazyAnimation(Animation *animation);
+
+		void unloadLazyAnimation(Animation *animation);
+
+		void unloadUnusedAnimations(Animation *keep);
+
+		size_t quantizeAnimation(Animation *animation);
+
+		/// @return May be NULL.
+		UpdateCacheTemplate *findUpdateCacheTemplate(Vector<int> &skinKey);
+
+		/// Takes ownership of the template, which is deleted if one for its skin key was added first or the maximum number
+		/// of templates was reached.
+		void addUpdateCacheTemplate(UpdateCacheTemplate *updateCacheTemplate);
+
+		// Declared first so it is destroyed last, keeping the arena current while the other members free into it.
+		ArenaScope _arenaScope;
+		Arena *_arena;
 		String _name;
 		Vector<BoneData *> _bones; // Ordered parents first
 		Vector<SlotData *> _slots; // Setup pose draw order.
@@ -183,7 +273,26 @@ namespace spine {
         float _referenceScale;
 		String _version;
 		String _hash;
-		Vector<char *> _strings;
+		Vector<String> _strings; // Interned strings referenced by index from binary data, index 0 is empty.
+		NameIndex _boneIndex;
+		NameIndex _slotIndex;
+		NameIndex _skinIndex;
+		NameIndex _eventIndex;
+		NameIndex _animationIndex;
+		NameIndex _ikConstraintIndex;
+		NameIndex _transformConstraintIndex;
+		NameIndex _pathConstraintIndex;
+		NameIndex _physicsConstraintIndex;
+		size_t _attachmentIdsVersion;
+		SkeletonBinary *_animationReader; // Decodes lazily read animations, see SkeletonBinary::setLazyAnimations().
+		size_t _animationMemory;
+		size_t _animationMemoryBudget;
+		size_t _animationUses;
+		BezierTable _bezierTable;
+		bool _quantizeTimelines;
+		float _quantizeValueTolerance;
+		float _quantizeTimeTolerance;
+		Vector<UpdateCacheTemplate *> _updateCacheTemplates; // Guarded by a lock, see Skeleton::updateCache().
 
 		// Nonessential.
 		float _fps;
@@ -0,0 +1,73 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SkeletonPool_h
+#define Spine_SkeletonPool_h
+
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	class Skeleton;
+
+	class SkeletonData;
+
+	/// Recycles skeleton instances of one SkeletonData, so spawning and despawning many instances does not construct
+	/// and delete their bones, slots and constraints each time.
+	class SP_API SkeletonPool : public SpineObject {
+	public:
+		explicit SkeletonPool(SkeletonData *skeletonData);
+
+		/// Deletes the free skeletons. Skeletons obtained from the pool and not freed are owned by the caller.
+		~SkeletonPool();
+
+		/// Returns a free skeleton reset to the state of a newly constructed one, see Skeleton::reset(), or constructs a
+		/// new skeleton if none is free.
+		Skeleton *obtain();
+
+		/// Returns a skeleton to the pool. It must have been constructed for the pool's skeleton data.
+		void free(Skeleton *skeleton);
+
+		/// Constructs skeletons until the pool has at least the given number of free skeletons.
+		void fill(size_t count);
+
+		/// Deletes the free skeletons.
+		void clear();
+
+		size_t getFree();
+
+		SkeletonData *getSkeletonData();
+
+	private:
+		SkeletonData *_skeletonData;
+		Vector<Skeleton *> _free;
+	};
+}
+
+#endif /* Spine_SkeletonPool_h */
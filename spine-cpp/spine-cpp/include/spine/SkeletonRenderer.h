@@ -49,6 +49,56 @@ namespace spine {
         RenderCommand *next;
     };
 
+    /// Describes how SkeletonRenderer::render(Skeleton &, RenderStream &) writes a vertex. Offsets are in bytes from the
+    /// start of a vertex, a negative offset omits the attribute. Positions and UVs are written as two floats, colors as a
+    /// uint32_t in ARGB order, or in ABGR order if swapRedBlue is true.
+    struct SP_API VertexLayout {
+        int32_t stride;
+        int32_t positionOffset;
+        int32_t uvOffset;
+        int32_t colorOffset;
+        int32_t darkColorOffset;
+        bool swapRedBlue;
+    };
+
+    /// A range of vertices and indices written to a RenderStream that is drawn with the same texture and blend mode.
+    /// Indices are relative to firstVertex. If the layout omits colors or dark colors, all vertices of the batch have
+    /// the batch's color or dark color.
+    struct SP_API RenderBatch {
+        int32_t firstVertex;
+        int32_t numVertices;
+        int32_t firstIndex;
+        int32_t numIndices;
+        BlendMode blendMode;
+        void *texture;
+        uint32_t color;
+        uint32_t darkColor;
+    };
+
+    /// Caller-provided buffers, for example mapped GPU staging buffers, that SkeletonRenderer writes vertices and
+    /// indices to in a single pass, without building render commands. The vertex buffer must be 4 byte aligned.
+    class SP_API RenderStream : public SpineObject {
+    public:
+        VertexLayout layout;
+        void *vertices;
+        int32_t maxVertices;
+        uint16_t *indices;
+        int32_t maxIndices;
+
+        RenderStream();
+
+        virtual ~RenderStream();
+
+        /// Called for each batch once it is complete.
+        virtual void batch(const RenderBatch &batch) = 0;
+
+        /// Called when the vertices or indices of the next attachment do not fit into the remaining space of the buffers,
+        /// after all batches written so far were passed to batch(). Implementations submit those batches and may set new
+        /// buffers. Writing continues at the start of the buffers.
+        /// @return False to stop rendering, for example if the buffers can not be reused this frame.
+        virtual bool flush() = 0;
+    };
+
     class SP_API SkeletonRenderer: public SpineObject {
     public:
         explicit SkeletonRenderer();
@@ -56,6 +106,14 @@ namespace spine {
         ~SkeletonRenderer();
 
         RenderCommand *render(Skeleton &skeleton);
+
+        /// Writes the skeleton's vertices and indices directly into the stream's buffers and passes the resulting batches
+        /// to RenderStream::batch(). Batches are split on texture or blend mode changes, on color changes for colors the
+        /// layout omits, and before exceeding 65535 vertices. The batches in the buffers are not flushed when this
+        /// returns.
+        /// @return False if rendering stopped early, because RenderStream::flush() returned false or an attachment does
+        /// not fit into empty buffers.
+        bool render(Skeleton &skeleton, RenderStream &stream);
     private:
         BlockAllocator _allocator;
         Vector<float> _worldVertices;
@@ -53,6 +53,8 @@ namespace spine {
 		class SP_API AttachmentMap : public SpineObject {
 			friend class Skin;
 
+			friend class Skeleton;
+
 		public:
 			struct SP_API Entry {
 				size_t _slotIndex;
@@ -98,6 +100,8 @@ namespace spine {
 				size_t _bucketIndex;
 			};
 
+			/// Names interned by the loaders, see StringTable, are kept interned, so looking one up with an interned name
+			/// compares no characters. Other names are copied.
 			void put(size_t slotIndex, const String &attachmentName, Attachment *attachment);
 
 			Attachment *get(size_t slotIndex, const String &attachmentName);
@@ -113,7 +117,10 @@ namespace spine {
 
 			int findInBucket(Vector <Entry> &, const String &attachmentName);
 
-			Vector <Vector<Entry>> _buckets;
+			/// Puts all entries of another map's bucket. Copies the bucket directly if this map has no entries for the slot.
+			void putAll(size_t slotIndex, Vector <Entry> &entries);
+
+			Vector <Vector<Entry>> _buckets; // The entries by slot index.
 		};
 
 		explicit Skin(const String &name);
@@ -162,6 +169,7 @@ namespace spine {
 		Vector<BoneData *> _bones;
 		Vector<ConstraintData *> _constraints;
         Color _color;
+		size_t _version; // Changes when attachments are set or removed, see Skeleton::getAttachmentById().
 
 		/// Attach all attachments from this skin if the corresponding attachment from the old skin is currently attached.
 		void attachAll(Skeleton &skeleton, Skin &oldSkin);
@@ -33,6 +33,7 @@
 #include <spine/BlendMode.h>
 #include <spine/SpineObject.h>
 #include <spine/SpineString.h>
+#include <spine/Vector.h>
 #include <spine/Color.h>
 
 namespace spine {
@@ -79,6 +80,12 @@ namespace spine {
 
 		friend class TwoColorTimeline;
 
+		friend class SkeletonData;
+
+		friend class Skeleton;
+
+		friend class AnimationState;
+
 	public:
 		SlotData(int index, const String &name, BoneData &boneData);
 
@@ -118,6 +125,8 @@ namespace spine {
 
 		bool _hasDarkColor;
 		String _attachmentName;
+		int _attachmentId;
+		Vector<String> _attachmentKeys;
 		BlendMode _blendMode;
         bool _visible;
 	};
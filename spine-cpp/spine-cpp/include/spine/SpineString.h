@@ -39,11 +39,12 @@
 namespace spine {
 	class SP_API String : public SpineObject {
 	public:
-		String() : _length(0), _buffer(NULL), _tempowner(true) {
+		String() : _length(0), _buffer(NULL), _tempowner(true), _interned(false) {
 		}
 
 		String(const char *chars, bool own = false, bool tofree = true) {
 			_tempowner = tofree;
+			_interned = false;
 			if (!chars) {
 				_length = 0;
 				_buffer = NULL;
@@ -60,7 +61,10 @@ namespace spine {
 
 		String(const String &other) {
 			_tempowner = true;
-			if (!other._buffer) {
+			_interned = false;
+			if (other._interned) {
+				share(other);
+			} else if (!other._buffer) {
 				_length = 0;
 				_buffer = NULL;
 			} else {
@@ -82,6 +86,12 @@ namespace spine {
 			return _buffer;
 		}
 
+		/// True if the characters belong to the StringTable. Copies of an interned string share its characters, and two
+		/// interned strings are equal only if they share them. See StringTable::intern().
+		bool isInterned() const {
+			return _interned;
+		}
+
 		void own(const String &other) {
 			if (this == &other) return;
 			if (_buffer && _tempowner) {
@@ -89,8 +99,11 @@ namespace spine {
 			}
 			_length = other._length;
 			_buffer = other._buffer;
+			_tempowner = other._tempowner;
+			_interned = other._interned;
 			other._length = 0;
 			other._buffer = NULL;
+			other._interned = false;
 		}
 
 		void own(const char *chars) {
@@ -99,6 +112,8 @@ namespace spine {
 				SpineExtension::free(_buffer, __FILE__, __LINE__);
 			}
 
+			_tempowner = true;
+			_interned = false;
 			if (!chars) {
 				_length = 0;
 				_buffer = NULL;
@@ -111,6 +126,7 @@ namespace spine {
 		void unown() {
 			_length = 0;
 			_buffer = NULL;
+			_interned = false;
 		}
 
 		String &operator=(const String &other) {
@@ -118,7 +134,11 @@ namespace spine {
 			if (_buffer && _tempowner) {
 				SpineExtension::free(_buffer, __FILE__, __LINE__);
 			}
-			if (!other._buffer) {
+			_tempowner = true;
+			_interned = false;
+			if (other._interned) {
+				share(other);
+			} else if (!other._buffer) {
 				_length = 0;
 				_buffer = NULL;
 			} else {
@@ -134,6 +154,8 @@ namespace spine {
 			if (_buffer && _tempowner) {
 				SpineExtension::free(_buffer, __FILE__, __LINE__);
 			}
+			_tempowner = true;
+			_interned = false;
 			if (!chars) {
 				_length = 0;
 				_buffer = NULL;
@@ -146,6 +168,7 @@ namespace spine {
 		}
 
 		String &append(const char *chars) {
+			if (_interned) unshare();
 			size_t len = strlen(chars);
 			size_t thisLen = _length;
 			_length = _length + len;
@@ -156,6 +179,7 @@ namespace spine {
 		}
 
 		String &append(const String &other) {
+			if (_interned) unshare();
 			size_t len = other.length();
 			size_t thisLen = _length;
 			_length = _length + len;
@@ -217,7 +241,7 @@ namespace spine {
 
 		friend bool operator==(const String &a, const String &b) {
 			if (a._buffer == b._buffer) return true;
-			if (a._length != b._length) return false;
+			if (a._length != b._length || (a._interned && b._interned)) return false;
 			if (a._buffer && b._buffer) {
 				return strcmp(a._buffer, b._buffer) == 0;
 			} else {
@@ -239,6 +263,25 @@ namespace spine {
 		mutable size_t _length;
 		mutable char *_buffer;
 		mutable bool _tempowner;
+		mutable bool _interned;
+
+		friend class StringTable;
+
+		void share(const String &other) {
+			_length = other._length;
+			_buffer = other._buffer;
+			_tempowner = false;
+			_interned = true;
+		}
+
+		// Copies the characters so they can be modified without changing the StringTable.
+		void unshare() {
+			char *chars = SpineExtension::calloc<char>(_length + 1, __FILE__, __LINE__);
+			memcpy((void *) chars, _buffer, _length + 1);
+			_buffer = chars;
+			_tempowner = true;
+			_interned = false;
+		}
 	};
 }
 
@@ -0,0 +1,74 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_StringTable_h
+#define Spine_StringTable_h
+
+#include <spine/SpineString.h>
+
+namespace spine {
+	/// Process wide table of interned strings, used by SkeletonJson and SkeletonBinary for the names of bones, slots,
+	/// constraints, skins, attachments, events and animations. Each distinct string is stored once together with its
+	/// hash. Strings returned by intern() and their copies share those characters, so comparing two interned strings
+	/// compares pointers, and HashMap and the SkeletonData find methods reuse the stored hash.
+	///
+	/// The table only grows: interned strings are never freed while the program runs, as copies may outlive the data
+	/// they were loaded for. Loading many skeletons with distinct names therefore keeps all of those names in memory until
+	/// clear() is called at shutdown, which must happen before DebugExtension::reportLeaks(). Only the loaders and
+	/// explicit intern() calls add strings, not names set at runtime, eg with Skin::setAttachment().
+	///
+	/// Interning a string that is not interned yet takes a process wide lock unless SPINE_NO_THREADS is defined.
+	class SP_API StringTable : public SpineObject {
+	private:
+		StringTable();
+
+	public:
+		/// @return The interned string, or an empty string if chars is NULL or empty.
+		static String intern(const char *chars);
+
+		/// Interns the first length characters, which don't have to be null terminated.
+		static String intern(const char *chars, size_t length);
+
+		static String intern(const String &string);
+
+		/// The hash HashMapHash<String> computes for the string's characters.
+		static size_t getHash(const String &string) {
+			return ((const size_t *) (const void *) string.buffer())[-1];
+		}
+
+		/// The number of interned strings.
+		static size_t getCount();
+
+		/// Frees all interned strings, for example before DebugExtension::reportLeaks() at shutdown. No interned string
+		/// or skeleton data loaded before may be used afterwards.
+		static void clear();
+	};
+}
+
+#endif /* Spine_StringTable_h */
@@ -0,0 +1,90 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_TaskRunner_h
+#define Spine_TaskRunner_h
+
+#include <spine/SpineObject.h>
+
+namespace spine {
+	/// Runs a number of independent tasks, possibly concurrently. Used by SkeletonBatchUpdater. Implement this to run
+	/// the tasks on an engine's own job system.
+	class SP_API TaskRunner : public SpineObject {
+	public:
+		typedef void (*Task)(void *context, size_t index);
+
+		TaskRunner();
+
+		virtual ~TaskRunner();
+
+		/// Calls task(context, index) once for every index in [0, count) and returns when all calls have completed.
+		/// The calls may run concurrently and in any order.
+		virtual void run(size_t count, Task task, void *context) = 0;
+	};
+
+	/// Runs all tasks on the calling thread.
+	class SP_API SerialTaskRunner : public TaskRunner {
+	public:
+		SerialTaskRunner();
+
+		virtual ~SerialTaskRunner();
+
+		virtual void run(size_t count, Task task, void *context) override;
+	};
+
+#ifndef SPINE_NO_THREADS
+	/// Runs tasks on a fixed set of worker threads and the calling thread. Threads claim the next unclaimed task from a
+	/// shared counter, so threads that finish early keep taking work until all tasks are done. Define SPINE_NO_THREADS
+	/// on platforms without thread support.
+	class SP_API ThreadPoolTaskRunner : public TaskRunner {
+	public:
+		/// @param threadCount The number of worker threads in addition to the calling thread. If < 0, the hardware
+		/// concurrency minus one is used.
+		explicit ThreadPoolTaskRunner(int threadCount = -1);
+
+		virtual ~ThreadPoolTaskRunner();
+
+		virtual void run(size_t count, Task task, void *context) override;
+
+		/// The number of worker threads, not counting the thread calling run().
+		int getThreadCount();
+
+	private:
+		struct State;
+
+		State *_state;
+
+		ThreadPoolTaskRunner(const ThreadPoolTaskRunner &);
+
+		ThreadPoolTaskRunner &operator=(const ThreadPoolTaskRunner &);
+	};
+#endif
+}
+
+#endif /* Spine_TaskRunner_h */
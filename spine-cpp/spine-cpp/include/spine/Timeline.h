@@ -66,11 +66,12 @@ namespace spine {
 
 		size_t getFrameEntries();
 
-		size_t getFrameCount();
+		virtual size_t getFrameCount();
 
+		/// Empty for a quantized timeline, see CurveTimeline::quantize().
 		Vector<float> &getFrames();
 
-		float getDuration();
+		virtual float getDuration();
 
 		virtual Vector <PropertyId> &getPropertyIds();
 
@@ -0,0 +1,59 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_UpdateCacheTemplate_h
+#define Spine_UpdateCacheTemplate_h
+
+#include <spine/Vector.h>
+
+namespace spine {
+	class Attachment;
+
+	/// The update cache Skeleton::updateCache() computed for a skin, or for no skin, by bone index and constraint order.
+	/// SkeletonData keeps one for each skin key, so other skeletons and later changes to a skin with the same bones,
+	/// constraints and path attachments copy it instead of sorting the bones and constraints again.
+	class SP_API UpdateCacheTemplate : public SpineObject {
+		friend class Skeleton;
+
+		friend class SkeletonData;
+
+	private:
+		Vector<int> _skinKey; // See Skeleton::updateSkinKey().
+		Vector<int> _updatables; // A bone index, or -1 - the order of a constraint.
+		Vector<int> _boneRunEnds;
+		size_t _longestRun;
+		Vector<bool> _active; // For each bone, then for each constraint by order.
+		Vector<Attachment *> _pathAttachments; // The attachment of each path constraint's target slot.
+
+		UpdateCacheTemplate() : _longestRun(0) {
+		}
+	};
+}
+
+#endif /* Spine_UpdateCacheTemplate_h */
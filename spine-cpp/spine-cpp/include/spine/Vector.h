@@ -68,6 +68,22 @@ namespace spine {
 			return _capacity;
 		}
 
+		/// Reduces the capacity to the size, releasing the buffer if the vector is empty.
+		inline void shrink() {
+			if (_capacity == _size) return;
+			T *buffer = NULL;
+			if (_size > 0) {
+				buffer = allocate(_size);
+				for (size_t i = 0; i < _size; ++i) {
+					construct(buffer + i, _buffer[i]);
+					destroy(_buffer + i);
+				}
+			}
+			deallocate(_buffer);
+			_buffer = buffer;
+			_capacity = _size;
+		}
+
 		inline size_t size() const {
 			return _size;
 		}
@@ -33,12 +33,14 @@
 #include <spine/Animation.h>
 #include <spine/AnimationState.h>
 #include <spine/AnimationStateData.h>
+#include <spine/Arena.h>
 #include <spine/Atlas.h>
 #include <spine/AtlasAttachmentLoader.h>
 #include <spine/Attachment.h>
 #include <spine/AttachmentLoader.h>
 #include <spine/AttachmentTimeline.h>
 #include <spine/AttachmentType.h>
+#include <spine/BezierTable.h>
 #include <spine/BlendMode.h>
 #include <spine/Bone.h>
 #include <spine/BoneData.h>
@@ -68,6 +70,7 @@
 #include <spine/MeshAttachment.h>
 #include <spine/MixBlend.h>
 #include <spine/MixDirection.h>
+#include <spine/NameIndex.h>
 #include <spine/PathAttachment.h>
 #include <spine/PathConstraint.h>
 #include <spine/PathConstraintData.h>
@@ -88,11 +91,14 @@
 #include <spine/ScaleTimeline.h>
 #include <spine/ShearTimeline.h>
 #include <spine/Skeleton.h>
+#include <spine/SkeletonBatchUpdater.h>
 #include <spine/SkeletonBinary.h>
 #include <spine/SkeletonBounds.h>
+#include <spine/SkeletonBoundsGrid.h>
 #include <spine/SkeletonClipping.h>
 #include <spine/SkeletonData.h>
 #include <spine/SkeletonJson.h>
+#include <spine/SkeletonPool.h>
 #include <spine/SkeletonRenderer.h>
 #include <spine/Skin.h>
 #include <spine/Slot.h>
@@ -100,6 +106,8 @@
 #include <spine/SpacingMode.h>
 #include <spine/SpineObject.h>
 #include <spine/SpineString.h>
+#include <spine/StringTable.h>
+#include <spine/TaskRunner.h>
 #include <spine/TextureLoader.h>
 #include <spine/Timeline.h>
 #include <spine/TransformConstraint.h>
@@ -108,6 +116,7 @@
 #include <spine/TranslateTimeline.h>
 #include <spine/Triangulator.h>
 #include <spine/Updatable.h>
+#include <spine/UpdateCacheTemplate.h>
 #include <spine/Vector.h>
 #include <spine/VertexAttachment.h>
 #include <spine/Vertices.h>
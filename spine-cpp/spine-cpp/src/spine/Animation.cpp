@@ -38,11 +38,23 @@
 
 using namespace spine;
 
-Animation::Animation(const String &name, Vector<Timeline *> &timelines, float duration) : _timelines(timelines),
+Animation::Animation(const String &name, Vector<Timeline *> &timelines, float duration) : _timelines(),
 																						  _timelineIds(),
 																						  _duration(duration),
-																						  _name(name) {
+																						  _name(name),
+																						  _lazyData(NULL),
+																						  _lazyOffset(0),
+																						  _memory(0),
+																						  _lastUse(0),
+																						  _useCount(0),
+																						  _loaded(true) {
 	assert(_name.length() > 0);
+	setTimelines(timelines);
+}
+
+void Animation::setTimelines(Vector<Timeline *> &timelines) {
+	_timelines.clearAndAddAll(timelines);
+	_timelineIds.clear();
 	for (size_t i = 0; i < timelines.size(); i++) {
 		Vector<PropertyId> propertyIds = timelines[i]->getPropertyIds();
 		for (size_t ii = 0; ii < propertyIds.size(); ii++)
@@ -91,17 +103,32 @@ void Animation::setDuration(float inValue) {
 	_duration = inValue;
 }
 
+bool Animation::isLoaded() {
+	return _loaded;
+}
+
 int Animation::search(Vector<float> &frames, float target) {
-	size_t n = (int) frames.size();
-	for (size_t i = 1; i < n; i++) {
-		if (frames[i] > target) return (int) (i - 1);
-	}
-	return (int) (n - 1);
+	return search(frames, target, 1);
 }
 
 int Animation::search(Vector<float> &frames, float target, int step) {
-	size_t n = frames.size();
-	for (size_t i = step; i < n; i += step)
-		if (frames[i] > target) return (int) (i - step);
-	return (int) (n - step);
+	float *values = frames.buffer();
+	int size = (int) frames.size();
+	// A linear scan is as fast up to about 16 frames, see tests/AnimationSearchBenchmark.cpp.
+	if (size <= step * 16) {
+		for (int i = step; i < size; i += step)
+			if (values[i] > target) return i - step;
+		return size - step;
+	}
+
+	int n = size / step;
+	// Find the first frame after the target, frames are sorted by time.
+	int low = 1, high = n;
+	while (low < high) {
+		int middle = (low + high) >> 1;
+		if (values[middle * step] > target) high = middle;
+		else
+			low = middle + 1;
+	}
+	return (low - 1) * step;
 }
@@ -63,7 +63,9 @@ TrackEntry::TrackEntry() : _animation(NULL), _previous(NULL), _next(NULL), _mixi
 						   _listener(dummyOnAnimationEventFunc), _listenerObject(NULL) {
 }
 
-TrackEntry::~TrackEntry() {}
+TrackEntry::~TrackEntry() {
+	if (_animation && _animation->_lazyData) _animation->_lazyData->releaseAnimation(_animation);
+}
 
 int TrackEntry::getTrackIndex() { return _trackIndex; }
 
@@ -191,6 +193,7 @@ void TrackEntry::setListener(AnimationStateListenerObject *inValue) {
 }
 
 void TrackEntry::reset() {
+	if (_animation && _animation->_lazyData) _animation->_lazyData->releaseAnimation(_animation);
 	_animation = NULL;
 	_previous = NULL;
 	_next = NULL;
@@ -508,8 +511,11 @@ bool AnimationState::apply(Skeleton &skeleton) {
 	for (int i = 0, n = (int) slots.size(); i < n; i++) {
 		Slot *slot = slots[i];
 		if (slot->getAttachmentState() == setupState) {
-			const String &attachmentName = slot->getData().getAttachmentName();
-			slot->setAttachment(attachmentName.isEmpty() ? NULL : skeleton.getAttachment(slot->getData().getIndex(), attachmentName));
+			SlotData &data = slot->getData();
+			if (data._attachmentId >= 0)
+				slot->setAttachment(skeleton.getAttachmentById(data.getIndex(), data._attachmentId));
+			else
+				slot->setAttachment(data._attachmentName.isEmpty() ? NULL : skeleton.getAttachment(data.getIndex(), data._attachmentName));
 		}
 	}
 	_unkeyedState += 2;
@@ -709,10 +715,11 @@ void AnimationState::applyAttachmentTimeline(AttachmentTimeline *attachmentTimel
 	Vector<float> &frames = attachmentTimeline->getFrames();
 	if (time < frames[0]) {
 		if (blend == MixBlend_Setup || blend == MixBlend_First)
-			setAttachment(skeleton, *slot, slot->getData().getAttachmentName(), attachments);
+			setAttachment(skeleton, *slot, slot->getData()._attachmentName, slot->getData()._attachmentId, attachments);
 	} else {
-		setAttachment(skeleton, *slot, attachmentTimeline->getAttachmentNames()[Animation::search(frames, time)],
-					  attachments);
+		int frame = Animation::search(frames, time);
+		setAttachment(skeleton, *slot, attachmentTimeline->getAttachmentNames()[frame],
+					  attachmentTimeline->getAttachmentIds()[frame], attachments);
 	}
 
 	/* If an attachment wasn't set (ie before the first frame or attachments is false), set the setup attachment later.*/
@@ -731,9 +738,8 @@ void AnimationState::applyRotateTimeline(RotateTimeline *rotateTimeline, Skeleto
 
 	Bone *bone = skeleton._bones[rotateTimeline->_boneIndex];
 	if (!bone->isActive()) return;
-	Vector<float> &frames = rotateTimeline->_frames;
 	float r1, r2;
-	if (time < frames[0]) {
+	if (time < rotateTimeline->getFirstTime()) {
 		switch (blend) {
 			case MixBlend_Setup:
 				bone->_rotation = bone->_data._rotation;
@@ -912,9 +918,13 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 	return mix;
 }
 
-void AnimationState::setAttachment(Skeleton &skeleton, Slot &slot, const String &attachmentName, bool attachments) {
-	slot.setAttachment(
-			attachmentName.isEmpty() ? NULL : skeleton.getAttachment(slot.getData().getIndex(), attachmentName));
+void AnimationState::setAttachment(Skeleton &skeleton, Slot &slot, const String &attachmentName, int attachmentId,
+								   bool attachments) {
+	int slotIndex = slot.getData().getIndex();
+	if (attachmentId >= 0)
+		slot.setAttachment(skeleton.getAttachmentById(slotIndex, attachmentId));
+	else
+		slot.setAttachment(attachmentName.isEmpty() ? NULL : skeleton.getAttachment(slotIndex, attachmentName));
 	if (attachments) slot.setAttachmentState(_unkeyedState + Current);
 }
 
@@ -988,6 +998,10 @@ TrackEntry *AnimationState::newTrackEntry(size_t trackIndex, Animation *animatio
 	TrackEntry *entryP = _trackEntryPool.obtain();// Pooling
 	TrackEntry &entry = *entryP;
 
+	// Lazily read animations are decoded when first used and stay loaded while a track entry uses them. An animation
+	// that fails to decode is not loaded, so the entry must not reference it.
+	if (animation->_lazyData && !animation->_lazyData->loadAnimation(animation)) animation = getEmptyAnimation();
+
 	entry._trackIndex = (int) trackIndex;
 	entry._animation = animation;
 	entry._loop = loop;
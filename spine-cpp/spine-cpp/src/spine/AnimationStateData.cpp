@@ -84,3 +84,8 @@ AnimationStateData::AnimationPair::AnimationPair(Animation *a1, Animation *a2) :
 bool AnimationStateData::AnimationPair::operator==(const AnimationPair &other) const {
 	return _a1->_name == other._a1->_name && _a2->_name == other._a2->_name;
 }
+
+size_t AnimationStateData::AnimationPair::hash() const {
+	const String &n1 = _a1->_name, &n2 = _a2->_name;
+	return hashMapString(n1.buffer(), n1.length()) * 31 + hashMapString(n2.buffer(), n2.length());
+}
@@ -0,0 +1,311 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/Arena.h>
+
+#include <spine/Extension.h>
+
+#include <assert.h>
+#include <string.h>
+
+#ifndef SPINE_NO_THREADS
+#include <atomic>
+#include <mutex>
+#endif
+
+using namespace spine;
+
+// Each allocation is preceded by a header holding its capacity and size, which keeps the 16 byte alignment of the
+// block allocator.
+struct ArenaHeader {
+	size_t capacity;
+	size_t size;
+};
+
+static const size_t HEADER_SIZE = 16;
+
+static thread_local Arena *_currentArena = NULL;
+
+// The block ranges of all live arenas sorted by address, so memory can be returned to the arena owning it whichever
+// arena is current, see Arena::findOwner().
+struct LiveRange {
+	const uint8_t *start;
+	const uint8_t *end;
+	Arena *arena;
+};
+
+static LiveRange *_liveRanges = NULL;
+static size_t _liveRangesCapacity = 0;
+
+#ifndef SPINE_NO_THREADS
+static std::atomic<size_t> _numLiveRanges(0);
+
+// Recursive, as growing the ranges frees the old ranges through the extension, which looks up their owner.
+static std::recursive_mutex &getLiveRangesMutex() {
+	static std::recursive_mutex mutex;
+	return mutex;
+}
+#else
+static size_t _numLiveRanges = 0;
+#endif
+
+static void addLiveRange(const uint8_t *start, const uint8_t *end, Arena *arena) {
+#ifndef SPINE_NO_THREADS
+	std::lock_guard<std::recursive_mutex> lock(getLiveRangesMutex());
+#endif
+	size_t count = _numLiveRanges;
+	if (count == _liveRangesCapacity) {
+		ArenaScope arenaScope(NULL);
+		size_t capacity = _liveRangesCapacity == 0 ? 64 : _liveRangesCapacity << 1;
+		LiveRange *ranges = SpineExtension::alloc<LiveRange>(capacity, __FILE__, __LINE__);
+		if (count) memcpy(ranges, _liveRanges, count * sizeof(LiveRange));
+		LiveRange *oldRanges = _liveRanges;
+		_liveRanges = ranges;
+		_liveRangesCapacity = capacity;
+		if (oldRanges) SpineExtension::free(oldRanges, __FILE__, __LINE__);
+	}
+	size_t index = count;
+	for (; index > 0 && _liveRanges[index - 1].start > start; index--)
+		_liveRanges[index] = _liveRanges[index - 1];
+	LiveRange range = {start, end, arena};
+	_liveRanges[index] = range;
+	_numLiveRanges = count + 1;
+}
+
+// Moves the ranges of one arena to another, or removes them if the other arena is NULL.
+static void moveLiveRanges(Arena *arena, Arena *other) {
+#ifndef SPINE_NO_THREADS
+	std::lock_guard<std::recursive_mutex> lock(getLiveRangesMutex());
+#endif
+	size_t count = _numLiveRanges, kept = 0;
+	for (size_t i = 0; i < count; i++) {
+		if (_liveRanges[i].arena == arena) {
+			if (!other) continue;
+			_liveRanges[i].arena = other;
+		}
+		_liveRanges[kept++] = _liveRanges[i];
+	}
+	_numLiveRanges = kept;
+}
+
+static inline ArenaHeader *getHeader(void *ptr) {
+	return (ArenaHeader *) ((uint8_t *) ptr - HEADER_SIZE);
+}
+
+static inline size_t alignSize(size_t size) {
+	return (size + 15) & ~(size_t) 15;
+}
+
+Arena::Arena(int blockSize) : _blocks(blockSize), _numBlocks(0), _size(0), _used(0) {
+	addRanges();
+}
+
+Arena::~Arena() {
+	if (_currentArena == this) _currentArena = NULL;
+	// Before the blocks are released, so freeing them isn't mistaken for freeing memory owned by this arena.
+	moveLiveRanges(this, NULL);
+	Arena *previous = setCurrent(NULL);
+	for (size_t i = 0; i < _merged.size(); i++)
+		delete _merged[i];
+	setCurrent(previous);
+}
+
+void *Arena::alloc(size_t size, bool clear) {
+	if (size == 0) return NULL;
+	size_t capacity = alignSize(size);
+	// The block allocator and the block ranges allocate through the extension, which must not end up in this arena.
+	Arena *previous = setCurrent(NULL);
+	uint8_t *memory = _blocks.allocate<uint8_t>(HEADER_SIZE + capacity);
+	if (_blocks.getNumBlocks() != _numBlocks) addRanges();
+	setCurrent(previous);
+
+	void *ptr = memory + HEADER_SIZE;
+	ArenaHeader *header = getHeader(ptr);
+	header->capacity = capacity;
+	header->size = size;
+	_used += size;
+	if (clear) memset(ptr, 0, size);
+	return ptr;
+}
+
+void *Arena::realloc(void *ptr, size_t size) {
+	if (!ptr) return alloc(size, false);
+	ArenaHeader *header = getHeader(ptr);
+	if (size <= header->capacity) {
+		_used += size;
+		_used -= header->size;
+		header->size = size;
+		return ptr;
+	}
+
+	// Grow in place if this is the last allocation of the last block.
+	size_t capacity = alignSize(size);
+	Block &block = _blocks.getBlock(_blocks.getNumBlocks() - 1);
+	if ((uint8_t *) ptr + header->capacity == block.memory + block.allocated &&
+		block.canFit((int) (capacity - header->capacity))) {
+		block.allocate((int) (capacity - header->capacity));
+		_used += size;
+		_used -= header->size;
+		header->capacity = capacity;
+		header->size = size;
+		return ptr;
+	}
+
+	void *newPtr = alloc(size, false);
+	memcpy(newPtr, ptr, header->size);
+	free(ptr);
+	return newPtr;
+}
+
+void Arena::free(void *ptr) {
+	if (!ptr) return;
+	ArenaHeader *header = getHeader(ptr);
+	_used -= header->size;
+	header->size = 0;
+}
+
+bool Arena::owns(const void *ptr) {
+	const uint8_t *address = (const uint8_t *) ptr;
+	int low = 0, high = (int) _ranges.size() - 1;
+	while (low <= high) {
+		int middle = (low + high) >> 1;
+		Range &range = _ranges[middle];
+		if (address < range.start)
+			high = middle - 1;
+		else if (address >= range.end)
+			low = middle + 1;
+		else
+			return true;
+	}
+	return false;
+}
+
+Arena *Arena::findOwner(const void *ptr) {
+	if (!ptr || _numLiveRanges == 0) return NULL;
+#ifndef SPINE_NO_THREADS
+	std::lock_guard<std::recursive_mutex> lock(getLiveRangesMutex());
+#endif
+	const uint8_t *address = (const uint8_t *) ptr;
+	int low = 0, high = (int) _numLiveRanges - 1;
+	while (low <= high) {
+		int middle = (low + high) >> 1;
+		LiveRange &range = _liveRanges[middle];
+		if (address < range.start)
+			high = middle - 1;
+		else if (address >= range.end)
+			low = middle + 1;
+		else
+			return range.arena;
+	}
+	return NULL;
+}
+
+size_t Arena::getAllocationSize(const void *ptr) {
+	return ptr ? getHeader((void *) ptr)->size : 0;
+}
+
+void Arena::merge(Arena *other) {
+	Arena *previous = setCurrent(NULL);
+	for (size_t i = 0; i < other->_ranges.size(); i++)
+		addRange(other->_ranges[i].start, other->_ranges[i].end);
+	_size += other->_size;
+	_used += other->_used;
+	_merged.add(other);
+	moveLiveRanges(other, this);
+	setCurrent(previous);
+}
+
+size_t Arena::getSize() {
+	return _size;
+}
+
+size_t Arena::getWaste() {
+	return _size - _used;
+}
+
+Arena *Arena::getCurrent() {
+	return _currentArena;
+}
+
+Arena *Arena::setCurrent(Arena *arena) {
+	Arena *previous = _currentArena;
+	_currentArena = arena;
+	return previous;
+}
+
+void Arena::addRanges() {
+	// Ranges are kept sorted by address so owns() can binary search them.
+	for (size_t n = _blocks.getNumBlocks(); _numBlocks < n; _numBlocks++) {
+		Block &block = _blocks.getBlock(_numBlocks);
+		addRange(block.memory, block.memory + block.size);
+		addLiveRange(block.memory, block.memory + block.size, this);
+		_size += block.size;
+	}
+}
+
+void Arena::addRange(const uint8_t *start, const uint8_t *end) {
+	Range range = {start, end};
+	size_t index = _ranges.size();
+	_ranges.add(range);
+	for (; index > 0 && _ranges[index - 1].start > range.start; index--)
+		_ranges[index] = _ranges[index - 1];
+	_ranges[index] = range;
+}
+
+ArenaScope::ArenaScope() : _arena(NULL), _previous(NULL), _active(false), _ownsArena(false) {
+}
+
+ArenaScope::ArenaScope(Arena *arena, bool ownsArena) : _arena(NULL), _previous(NULL), _active(false),
+													   _ownsArena(false) {
+	enter(arena, ownsArena);
+}
+
+ArenaScope::~ArenaScope() {
+	exit();
+}
+
+void ArenaScope::enter(Arena *arena, bool ownsArena) {
+	assert(!_active);
+	_arena = arena;
+	_ownsArena = ownsArena;
+	_previous = Arena::setCurrent(arena);
+	_active = true;
+}
+
+void ArenaScope::exit() {
+	if (!_active) return;
+	_active = false;
+	Arena::setCurrent(_previous);
+	if (_ownsArena) delete _arena;
+}
+
+Arena *ArenaScope::release() {
+	_ownsArena = false;
+	return _arena;
+}
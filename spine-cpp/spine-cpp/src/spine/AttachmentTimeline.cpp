@@ -51,12 +51,16 @@ AttachmentTimeline::AttachmentTimeline(size_t frameCount, int slotIndex) : Timel
 	for (size_t i = 0; i < frameCount; ++i) {
 		_attachmentNames.add(String());
 	}
+	_attachmentIds.setSize(frameCount, -1);
 }
 
 AttachmentTimeline::~AttachmentTimeline() {}
 
-void AttachmentTimeline::setAttachment(Skeleton &skeleton, Slot &slot, String *attachmentName) {
-	slot.setAttachment(attachmentName == NULL || attachmentName->isEmpty() ? NULL : skeleton.getAttachment(_slotIndex, *attachmentName));
+void AttachmentTimeline::setAttachment(Skeleton &skeleton, Slot &slot, const String &attachmentName, int attachmentId) {
+	if (attachmentId >= 0)
+		slot.setAttachment(skeleton.getAttachmentById(_slotIndex, attachmentId));
+	else
+		slot.setAttachment(attachmentName.isEmpty() ? NULL : skeleton.getAttachment(_slotIndex, attachmentName));
 }
 
 void AttachmentTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
@@ -69,32 +73,44 @@ void AttachmentTimeline::apply(Skeleton &skeleton, float lastTime, float time, V
 	if (!slot->_bone._active) return;
 
 	if (direction == MixDirection_Out) {
-		if (blend == MixBlend_Setup) setAttachment(skeleton, *slot, &slot->_data._attachmentName);
+		if (blend == MixBlend_Setup) setAttachment(skeleton, *slot, slot->_data._attachmentName, slot->_data._attachmentId);
 		return;
 	}
 
 	if (time < _frames[0]) {
 		// Time is before first frame.
 		if (blend == MixBlend_Setup || blend == MixBlend_First) {
-			setAttachment(skeleton, *slot, &slot->_data._attachmentName);
+			setAttachment(skeleton, *slot, slot->_data._attachmentName, slot->_data._attachmentId);
 		}
 		return;
 	}
 
 	if (time < _frames[0]) {
 		if (blend == MixBlend_Setup || blend == MixBlend_First)
-			setAttachment(skeleton, *slot, &slot->_data._attachmentName);
+			setAttachment(skeleton, *slot, slot->_data._attachmentName, slot->_data._attachmentId);
 		return;
 	}
 
-	setAttachment(skeleton, *slot, &_attachmentNames[Animation::search(_frames, time)]);
+	int frame = Animation::search(_frames, time);
+	setAttachment(skeleton, *slot, _attachmentNames[frame], _attachmentIds[frame]);
 }
 
 void AttachmentTimeline::setFrame(int frame, float time, const String &attachmentName) {
 	_frames[frame] = time;
 	_attachmentNames[frame] = attachmentName;
+	_attachmentIds[frame] = -1;
 }
 
 Vector<String> &AttachmentTimeline::getAttachmentNames() {
 	return _attachmentNames;
 }
+
+Vector<int> &AttachmentTimeline::getAttachmentIds() {
+	return _attachmentIds;
+}
+
+void AttachmentTimeline::setSlotIndex(int inValue) {
+	_slotIndex = inValue;
+	for (size_t i = 0; i < _attachmentIds.size(); ++i)
+		_attachmentIds[i] = -1;
+}
@@ -0,0 +1,79 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/BezierTable.h>
+
+#include <spine/Arena.h>
+
+#include <string.h>
+
+using namespace spine;
+
+// Curves per block, blocks are never moved so the returned curves stay valid as the table grows.
+static const size_t BLOCK_CURVES = 64;
+
+size_t BezierTable::Key::hash() const {
+	return hashMapString((const char *) values, BezierTable::SIZE * sizeof(short));
+}
+
+bool BezierTable::Key::operator==(const Key &other) const {
+	return memcmp(values, other.values, BezierTable::SIZE * sizeof(short)) == 0;
+}
+
+BezierTable::BezierTable() : _blockUsed(BLOCK_CURVES) {
+}
+
+BezierTable::~BezierTable() {
+	for (size_t i = 0; i < _blocks.size(); i++)
+		SpineExtension::free(_blocks[i], __FILE__, __LINE__);
+}
+
+const short *BezierTable::add(const short *values) {
+	Key key(values);
+	if (_curves.containsKey(key)) return _curves[key];
+
+	ArenaScope arenaScope(NULL);
+	if (_blockUsed == BLOCK_CURVES) {
+		_blocks.add(SpineExtension::alloc<short>(BLOCK_CURVES * SIZE, __FILE__, __LINE__));
+		_blockUsed = 0;
+	}
+	short *curve = _blocks[_blocks.size() - 1] + _blockUsed++ * SIZE;
+	memcpy(curve, values, SIZE * sizeof(short));
+	_curves.put(Key(curve), curve);
+	return curve;
+}
+
+size_t BezierTable::size() {
+	return _curves.size();
+}
+
+size_t BezierTable::getMemory() {
+	// The hash map keeps about a third of its entries free.
+	return _blocks.size() * BLOCK_CURVES * SIZE * sizeof(short) + _curves.size() * 3 / 2 * (sizeof(Key) + sizeof(short *) + sizeof(size_t) + 1);
+}
@@ -102,10 +102,13 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 		float sy = skeleton.getScaleY();
 		float rx = (rotation + shearX) * MathUtil::Deg_Rad;
 		float ry = (rotation + 90 + shearY) * MathUtil::Deg_Rad;
-		_a = MathUtil::cos(rx) * scaleX * sx;
-		_b = MathUtil::cos(ry) * scaleY * sx;
-		_c = MathUtil::sin(rx) * scaleX * sy;
-		_d = MathUtil::sin(ry) * scaleY * sy;
+		float sinX, cosX, sinY, cosY;
+		MathUtil::sinCos(rx, sinX, cosX);
+		MathUtil::sinCos(ry, sinY, cosY);
+		_a = cosX * scaleX * sx;
+		_b = cosY * scaleY * sx;
+		_c = sinX * scaleX * sy;
+		_d = sinY * scaleY * sy;
 		_worldX = x * sx + _skeleton.getX();
 		_worldY = y * sy + _skeleton.getY();
 		return;
@@ -123,10 +126,13 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 		case Inherit_Normal: {
 			float rx = (rotation + shearX) * MathUtil::Deg_Rad;
 			float ry = (rotation + 90 + shearY) * MathUtil::Deg_Rad;
-			float la = MathUtil::cos(rx) * scaleX;
-			float lb = MathUtil::cos(ry) * scaleY;
-			float lc = MathUtil::sin(rx) * scaleX;
-			float ld = MathUtil::sin(ry) * scaleY;
+			float sinX, cosX, sinY, cosY;
+			MathUtil::sinCos(rx, sinX, cosX);
+			MathUtil::sinCos(ry, sinY, cosY);
+			float la = cosX * scaleX;
+			float lb = cosY * scaleY;
+			float lc = sinX * scaleX;
+			float ld = sinY * scaleY;
 			_a = pa * la + pb * lc;
 			_b = pa * lb + pb * ld;
 			_c = pc * la + pd * lc;
@@ -136,10 +142,13 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 		case Inherit_OnlyTranslation: {
 			float rx = (rotation + shearX) * MathUtil::Deg_Rad;
 			float ry = (rotation + 90 + shearY) * MathUtil::Deg_Rad;
-			_a = MathUtil::cos(rx) * scaleX;
-			_b = MathUtil::cos(ry) * scaleY;
-			_c = MathUtil::sin(rx) * scaleX;
-			_d = MathUtil::sin(ry) * scaleY;
+			float sinX, cosX, sinY, cosY;
+			MathUtil::sinCos(rx, sinX, cosX);
+			MathUtil::sinCos(ry, sinY, cosY);
+			_a = cosX * scaleX;
+			_b = cosY * scaleY;
+			_c = sinX * scaleX;
+			_d = sinY * scaleY;
 			break;
 		}
 		case Inherit_NoRotationOrReflection: {
@@ -159,10 +168,13 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 			}
 			float rx = (rotation + shearX - prx) * MathUtil::Deg_Rad;
 			float ry = (rotation + shearY - prx + 90) * MathUtil::Deg_Rad;
-			float la = MathUtil::cos(rx) * scaleX;
-			float lb = MathUtil::cos(ry) * scaleY;
-			float lc = MathUtil::sin(rx) * scaleX;
-			float ld = MathUtil::sin(ry) * scaleY;
+			float sinX, cosX, sinY, cosY;
+			MathUtil::sinCos(rx, sinX, cosX);
+			MathUtil::sinCos(ry, sinY, cosY);
+			float la = cosX * scaleX;
+			float lb = cosY * scaleY;
+			float lc = sinX * scaleX;
+			float ld = sinY * scaleY;
 			_a = pa * la - pb * lc;
 			_b = pa * lb - pb * ld;
 			_c = pc * la + pd * lc;
@@ -172,8 +184,8 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 		case Inherit_NoScale:
 		case Inherit_NoScaleOrReflection: {
 			rotation *= MathUtil::Deg_Rad;
-			float cosine = MathUtil::cos(rotation);
-			float sine = MathUtil::sin(rotation);
+			float sine, cosine;
+			MathUtil::sinCos(rotation, sine, cosine);
 			float za = (pa * cosine + pb * sine) / _skeleton.getScaleX();
 			float zc = (pc * cosine + pd * sine) / _skeleton.getScaleY();
 			float s = MathUtil::sqrt(za * za + zc * zc);
@@ -185,14 +197,18 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 				(pa * pd - pb * pc < 0) != (_skeleton.getScaleX() < 0 != _skeleton.getScaleY() < 0))
 				s = -s;
 			rotation = MathUtil::Pi / 2 + MathUtil::atan2(zc, za);
-			float zb = MathUtil::cos(rotation) * s;
-			float zd = MathUtil::sin(rotation) * s;
+			MathUtil::sinCos(rotation, sine, cosine);
+			float zb = cosine * s;
+			float zd = sine * s;
 			shearX *= MathUtil::Deg_Rad;
 			shearY = (90 + shearY) * MathUtil::Deg_Rad;
-			float la = MathUtil::cos(shearX) * scaleX;
-			float lb = MathUtil::cos(shearY) * scaleY;
-			float lc = MathUtil::sin(shearX) * scaleX;
-			float ld = MathUtil::sin(shearY) * scaleY;
+			float sinX, cosX, sinY, cosY;
+			MathUtil::sinCos(shearX, sinX, cosX);
+			MathUtil::sinCos(shearY, sinY, cosY);
+			float la = cosX * scaleX;
+			float lb = cosY * scaleY;
+			float lc = sinX * scaleX;
+			float ld = sinY * scaleY;
 			_a = za * la + zb * lc;
 			_b = za * lb + zb * ld;
 			_c = zc * la + zd * lc;
@@ -256,19 +272,22 @@ void Bone::parentToWorld(float worldX, float worldY, float &outX, float &outY) {
 
 float Bone::worldToLocalRotation(float worldRotation) {
 	worldRotation *= MathUtil::Deg_Rad;
-	float sine = MathUtil::sin(worldRotation), cosine = MathUtil::cos(worldRotation);
+	float sine, cosine;
+	MathUtil::sinCos(worldRotation, sine, cosine);
 	return MathUtil::atan2Deg(_a * sine - _c * cosine, _d * cosine - _b * sine) + _rotation - _shearX;
 }
 
 float Bone::localToWorldRotation(float localRotation) {
 	localRotation = (localRotation - _rotation - _shearX) * MathUtil::Deg_Rad;
-	float sine = MathUtil::sin(localRotation), cosine = MathUtil::cos(localRotation);
+	float sine, cosine;
+	MathUtil::sinCos(localRotation, sine, cosine);
 	return MathUtil::atan2Deg(cosine * _c + sine * _d, cosine * _a + sine * _b);
 }
 
 void Bone::rotateWorld(float degrees) {
 	degrees *= MathUtil::Deg_Rad;
-	float sine = MathUtil::sin(degrees), cosine = MathUtil::cos(degrees);
+	float sine, cosine;
+	MathUtil::sinCos(degrees, sine, cosine);
 	float ra = _a, rb = _b;
 	_a = cosine * ra - sine * _c;
 	_b = cosine * rb - sine * _d;
@@ -540,7 +559,8 @@ void Bone::updateAppliedTransform() {
 			case Inherit_NoScale:
 			case Inherit_NoScaleOrReflection: {
 				float r = _rotation * MathUtil::Deg_Rad;
-				float cos = MathUtil::cos(r), sin = MathUtil::sin(r);
+				float sin, cos;
+				MathUtil::sinCos(r, sin, cos);
 				pa = (pa * cos + pb * sin) / _skeleton.getScaleX();
 				pc = (pc * cos + pd * sin) / _skeleton.getScaleY();
 				float s = MathUtil::sqrt(pa * pa + pc * pc);
@@ -552,8 +572,9 @@ void Bone::updateAppliedTransform() {
 					pid < 0 != (_skeleton.getScaleX() < 0 != _skeleton.getScaleY() < 0))
 					s = -s;
 				r = MathUtil::Pi / 2 + MathUtil::atan2(pc, pa);
-				pb = MathUtil::cos(r) * s;
-				pd = MathUtil::sin(r) * s;
+				MathUtil::sinCos(r, sin, cos);
+				pb = cos * s;
+				pd = sin * s;
 				pid = 1 / (pa * pd - pb * pc);
 				ia = pd * pid;
 				ib = pb * pid;
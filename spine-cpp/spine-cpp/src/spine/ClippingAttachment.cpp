@@ -29,7 +29,9 @@
 
 #include <spine/ClippingAttachment.h>
 
+#include <spine/SkeletonClipping.h>
 #include <spine/SlotData.h>
+#include <spine/Triangulator.h>
 
 using namespace spine;
 
@@ -54,5 +56,49 @@ Attachment *ClippingAttachment::copy() {
 	ClippingAttachment *copy = new (__FILE__, __LINE__) ClippingAttachment(getName());
 	copyTo(copy);
 	copy->_endSlot = _endSlot;
+	copy->_convexPolygons.clearAndAddAll(_convexPolygons);
+	copy->_convexPolygonLengths.clearAndAddAll(_convexPolygonLengths);
+	copy->_mirroredConvexPolygons.clearAndAddAll(_mirroredConvexPolygons);
+	copy->_mirroredConvexPolygonLengths.clearAndAddAll(_mirroredConvexPolygonLengths);
 	return copy;
 }
+
+void ClippingAttachment::updateConvexPolygons() {
+	_convexPolygons.clear();
+	_convexPolygonLengths.clear();
+	_mirroredConvexPolygons.clear();
+	_mirroredConvexPolygonLengths.clear();
+	size_t n = getWorldVerticesLength();
+	if (getBones().size() > 0 || n < 6 || getVertices().size() < n) return;
+	decompose(false, _convexPolygons, _convexPolygonLengths);
+	decompose(true, _mirroredConvexPolygons, _mirroredConvexPolygonLengths);
+}
+
+void ClippingAttachment::decompose(bool mirror, Vector<float> &polygons, Vector<int> &lengths) {
+	// Same steps as SkeletonClipping::clipStart, so the pieces match the ones decomposed in world space. A reflection
+	// changes the winding the triangulator sees, so the mirrored set is decomposed with x negated.
+	float sign = mirror ? -1.0f : 1.0f;
+	size_t n = getWorldVerticesLength();
+	Vector<float> &vertices = getVertices();
+	Vector<float> polygon;
+	polygon.setSize(n, 0);
+	for (size_t i = 0; i < n; i += 2) {
+		polygon[i] = vertices[i] * sign;
+		polygon[i + 1] = vertices[i + 1];
+	}
+	SkeletonClipping::makeClockwise(polygon);
+
+	Triangulator triangulator;
+	Vector<Vector<float> *> &convexPolygons = triangulator.decompose(polygon, triangulator.triangulate(polygon));
+	for (size_t i = 0; i < convexPolygons.size(); ++i) {
+		Vector<float> &convex = *convexPolygons[i];
+		SkeletonClipping::makeClockwise(convex);
+		for (size_t ii = 0; ii < convex.size(); ii += 2) {
+			polygons.add(convex[ii] * sign);
+			polygons.add(convex[ii + 1]);
+		}
+		polygons.add(convex[0] * sign);
+		polygons.add(convex[1]);
+		lengths.add((int) convex.size() + 2);
+	}
+}
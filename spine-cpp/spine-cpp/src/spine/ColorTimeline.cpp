@@ -235,7 +235,7 @@ void AlphaTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	Slot *slot = skeleton._slots[_slotIndex];
 	if (!slot->_bone._active) return;
 
-	if (time < _frames[0]) {// Time is before first frame.
+	if (time < getFirstTime()) {// Time is before first frame.
 		Color &color = slot->_color, &setup = slot->_data._color;
 		switch (blend) {
 			case MixBlend_Setup:
@@ -29,19 +29,70 @@
 
 #include <spine/CurveTimeline.h>
 
+#include <spine/Animation.h>
+#include <spine/BezierTable.h>
 #include <spine/MathUtil.h>
 
+#include <float.h>
+
 using namespace spine;
 
+// Curves of quantized timelines are checked against the original at these uniformly spaced times and at their points.
+static const int QUANTIZE_CHECK_SAMPLES = 16;
+
+static inline float dequantize(unsigned short value, float start, float scale) {
+	return start + value * scale;
+}
+
+static inline unsigned short quantize(float value, float start, float scale) {
+	if (scale == 0) return 0;
+	float quantized = (value - start) / scale + 0.5f;
+	if (quantized <= 0) return 0;
+	if (quantized >= 65535) return 65535;
+	return (unsigned short) quantized;
+}
+
+// Keys are usually on frames of the editor's frame rate, so times are quantized to frames when they fit, else to the
+// time range of the timeline.
+static float getTimeScale(const float *frames, size_t count, size_t frameEntries, float timeTolerance) {
+	static const int rates[] = {30, 60, 120, 240};
+	float start = frames[0], range = frames[count - frameEntries] - start;
+	for (size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++) {
+		float scale = 1.0f / rates[r];
+		if (range * rates[r] > 65535) break;
+		size_t i = 0;
+		for (; i < count; i += frameEntries) {
+			if (MathUtil::abs(dequantize(quantize(frames[i], start, scale), start, scale) - frames[i]) > timeTolerance) break;
+		}
+		if (i >= count) return scale;
+	}
+	return range / 65535;
+}
+
 RTTI_IMPL(CurveTimeline, Timeline)
 
-CurveTimeline::CurveTimeline(size_t frameCount, size_t frameEntries, size_t bezierCount) : Timeline(frameCount,
-																									frameEntries) {
+CurveTimeline::CurveTimeline(size_t frameCount, size_t frameEntries, size_t bezierCount) : Timeline(frameCount, frameEntries),
+																							   _bezierSamples(0),
+																							   _quantized(NULL) {
 	_curves.setSize(frameCount + bezierCount * BEZIER_SIZE, 0);
 	_curves[frameCount - 1] = STEPPED;
 }
 
 CurveTimeline::~CurveTimeline() {
+	delete _quantized;
+}
+
+size_t CurveTimeline::getFrameCount() {
+	if (_quantized) return _quantized->frameCount;
+	return _frames.size() / getFrameEntries();
+}
+
+float CurveTimeline::getDuration() {
+	if (_quantized) {
+		Quantized &quantized = *_quantized;
+		return dequantize(quantized.frames[(quantized.frameCount - 1) * getFrameEntries()], quantized.timeStart, quantized.timeScale);
+	}
+	return _frames[_frames.size() - getFrameEntries()];
 }
 
 void CurveTimeline::setLinear(size_t frame) {
@@ -74,6 +125,16 @@ void CurveTimeline::setBezier(size_t bezier, size_t frame, float value, float ti
 }
 
 float CurveTimeline::getBezierValue(float time, size_t frameIndex, size_t valueOffset, size_t i) {
+	if (_bezierSamples > 0) {
+		float *values = _bakedBeziers.buffer() + (i - CurveTimeline::getFrameCount()) / BEZIER_SIZE * (_bezierSamples + 1);
+		float x = _frames[frameIndex], duration = _frames[frameIndex + getFrameEntries()] - x;
+		float position = duration > 0 ? (time - x) / duration * _bezierSamples : 0;
+		if (position <= 0) return values[0];
+		if (position >= _bezierSamples) return values[_bezierSamples];
+		size_t sample = (size_t) position;
+		return values[sample] + (position - sample) * (values[sample + 1] - values[sample]);
+	}
+
 	if (_curves[i] > time) {
 		float x = _frames[frameIndex], y = _frames[frameIndex + valueOffset];
 		return y + (time - x) / (_curves[i] - x) * (_curves[i + 1] - y);
@@ -90,10 +151,252 @@ float CurveTimeline::getBezierValue(float time, size_t frameIndex, size_t valueO
 	return y + (time - x) / (_frames[frameIndex] - x) * (_frames[frameIndex + valueOffset] - y);
 }
 
+void CurveTimeline::bakeBeziers(size_t samples) {
+	_bezierSamples = 0;
+	_bakedBeziers.clear();
+	size_t frameEntries = getFrameEntries(), frameCount = getFrameCount();
+	size_t bezierCount = (_curves.size() - frameCount) / BEZIER_SIZE;
+	if (samples == 0 || bezierCount == 0 || frameEntries < 2) return;
+
+	_bakedBeziers.setSize(bezierCount * (samples + 1), 0);
+	// Beziers are numbered in frame order, the beziers of a frame are for its values in order. The frame's curve type
+	// points to the first of them, the next bezier frame's curve type marks the end.
+	for (size_t frame = 0; frame < frameCount - 1;) {
+		int curveType = (int) _curves[frame];
+		if (curveType < BEZIER) {
+			frame++;
+			continue;
+		}
+		size_t first = (curveType - BEZIER - frameCount) / BEZIER_SIZE, end = bezierCount;
+		size_t next = frame + 1;
+		for (; next < frameCount - 1; next++) {
+			if ((int) _curves[next] >= BEZIER) {
+				end = ((int) _curves[next] - BEZIER - frameCount) / BEZIER_SIZE;
+				break;
+			}
+		}
+
+		size_t frameIndex = frame * frameEntries;
+		float x = _frames[frameIndex], duration = _frames[frameIndex + frameEntries] - x;
+		for (size_t bezier = first; bezier < end; bezier++) {
+			size_t valueOffset = 1 + bezier - first;
+			if (valueOffset >= frameEntries) break;
+			size_t i = frameCount + bezier * BEZIER_SIZE;
+			float *values = _bakedBeziers.buffer() + bezier * (samples + 1);
+			for (size_t sample = 0; sample <= samples; sample++)
+				values[sample] = getBezierValue(x + duration * sample / samples, frameIndex, valueOffset, i);
+		}
+		frame = next;
+	}
+	_bezierSamples = samples;
+}
+
+size_t CurveTimeline::getBezierSamples() {
+	return _bezierSamples;
+}
+
 Vector<float> &CurveTimeline::getCurves() {
 	return _curves;
 }
 
+size_t CurveTimeline::quantize(float valueTolerance, float timeTolerance, BezierTable &table) {
+	SP_UNUSED(valueTolerance);
+	SP_UNUSED(timeTolerance);
+	SP_UNUSED(table);
+	return 0;
+}
+
+size_t CurveTimeline::getQuantizedMemorySaved() {
+	return _quantized ? _quantized->memorySaved : 0;
+}
+
+size_t CurveTimeline::quantizeFrames(float valueTolerance, float timeTolerance, BezierTable &table) {
+	size_t frameEntries = getFrameEntries(), frameCount = getFrameCount(), valueCount = frameEntries - 1;
+	if (_quantized || frameCount == 0 || valueCount > 2) return 0;
+	size_t bezierCount = (_curves.size() - frameCount) / BEZIER_SIZE;
+	if (BEZIER + bezierCount > 65535) return 0;
+
+	size_t memory = (_frames.getCapacity() + _curves.getCapacity() + _bakedBeziers.getCapacity()) * sizeof(float);
+	size_t quantizedMemory = sizeof(Quantized) + (_frames.size() + frameCount) * sizeof(unsigned short) +
+							 bezierCount * sizeof(short *);
+	if (quantizedMemory >= memory) return 0;
+
+	// Ranges of the times and of each value.
+	float *frames = _frames.buffer();
+	float start[3], end[3];
+	for (size_t ii = 0; ii < frameEntries; ii++)
+		start[ii] = end[ii] = frames[ii];
+	for (size_t i = frameEntries, n = _frames.size(); i < n; i += frameEntries) {
+		for (size_t ii = 0; ii < frameEntries; ii++) {
+			start[ii] = MathUtil::min(start[ii], frames[i + ii]);
+			end[ii] = MathUtil::max(end[ii], frames[i + ii]);
+		}
+	}
+	for (size_t ii = 0; ii < frameEntries; ii++)
+		if (!(end[ii] - start[ii] <= FLT_MAX)) return 0;
+
+	Quantized *quantized = new (__FILE__, __LINE__) Quantized();
+	quantized->frameCount = frameCount;
+	quantized->timeStart = start[0];
+	quantized->timeScale = getTimeScale(frames, _frames.size(), frameEntries, timeTolerance);
+	for (size_t ii = 0; ii < valueCount; ii++) {
+		quantized->valueStart[ii] = start[ii + 1];
+		quantized->valueScale[ii] = (end[ii + 1] - start[ii + 1]) / 65535;
+	}
+
+	// Frames, times must stay in order.
+	bool valid = true;
+	quantized->frames.ensureCapacity(_frames.size() + frameCount);
+	quantized->frames.setSize(_frames.size() + frameCount, 0);
+	unsigned short *quantizedFrames = quantized->frames.buffer(), *quantizedCurves = quantizedFrames + _frames.size();
+	for (size_t i = 0, n = _frames.size(); i < n && valid; i += frameEntries) {
+		quantizedFrames[i] = ::quantize(frames[i], quantized->timeStart, quantized->timeScale);
+		if (MathUtil::abs(dequantize(quantizedFrames[i], quantized->timeStart, quantized->timeScale) - frames[i]) > timeTolerance ||
+			(i > 0 && quantizedFrames[i] <= quantizedFrames[i - frameEntries]))
+			valid = false;
+		for (size_t ii = 0; ii < valueCount; ii++) {
+			float value = frames[i + 1 + ii], valueStart = quantized->valueStart[ii], valueScale = quantized->valueScale[ii];
+			quantizedFrames[i + 1 + ii] = ::quantize(value, valueStart, valueScale);
+			if (MathUtil::abs(dequantize(quantizedFrames[i + 1 + ii], valueStart, valueScale) - value) > valueTolerance)
+				valid = false;
+		}
+	}
+
+	// Beziers, normalized so they can be shared. A bezier for a value that doesn't change is stored as NULL when it is
+	// close enough to a line.
+	Vector<short> curves;
+	curves.ensureCapacity(bezierCount * BezierTable::SIZE);
+	curves.setSize(bezierCount * BezierTable::SIZE, 0);
+	quantized->beziers.ensureCapacity(bezierCount);
+	for (size_t frame = 0; frame < frameCount && valid; frame++) {
+		int curveType = (int) _curves[frame];
+		if (curveType < BEZIER) {
+			quantizedCurves[frame] = (unsigned short) curveType;
+			continue;
+		}
+		quantizedCurves[frame] = (unsigned short) (BEZIER + quantized->beziers.size());
+		float *frameValues = frames + frame * frameEntries;
+		float time1 = frameValues[0], duration = frameValues[frameEntries] - time1;
+		for (size_t ii = 0, i = curveType - BEZIER; ii < valueCount; ii++, i += BEZIER_SIZE) {
+			float value1 = frameValues[1 + ii], change = frameValues[frameEntries + 1 + ii] - value1;
+			short *curve = curves.buffer() + quantized->beziers.size() * BezierTable::SIZE;
+			for (int ii2 = 0; ii2 < BezierTable::SIZE; ii2 += 2) {
+				float x = (_curves[i + ii2] - time1) / duration, y = _curves[i + ii2 + 1] - value1;
+				if (change == 0) {
+					if (MathUtil::abs(y) > valueTolerance) valid = false;
+					continue;
+				}
+				y = y / change * BezierTable::Y_ONE;
+				if (!(y >= -32768 && y <= 32767) || !(x >= -0.0001f && x <= 1.0001f)) {
+					valid = false;
+					break;
+				}
+				curve[ii2] = (short) (MathUtil::clamp(x, 0.0f, 1.0f) * BezierTable::X_ONE + 0.5f);
+				curve[ii2 + 1] = (short) (y < 0 ? y - 0.5f : y + 0.5f);
+			}
+			quantized->beziers.add(change == 0 ? NULL : curve);
+		}
+	}
+
+	// Check the curves against the original, without the baked beziers.
+	size_t bezierSamples = _bezierSamples;
+	_bezierSamples = 0;
+	_quantized = quantized;
+	for (size_t frame = 0; frame < frameCount - 1 && valid; frame++) {
+		int curveType = (int) _curves[frame];
+		if (curveType < BEZIER) continue;
+		size_t frameIndex = frame * frameEntries;
+		float time1 = frames[frameIndex], duration = frames[frameIndex + frameEntries] - time1;
+		float quantizedTime1 = dequantize(quantizedFrames[frameIndex], quantized->timeStart, quantized->timeScale);
+		float quantizedDuration = dequantize(quantizedFrames[frameIndex + frameEntries], quantized->timeStart, quantized->timeScale) - quantizedTime1;
+		for (size_t ii = 0, i = curveType - BEZIER; ii < valueCount && valid; ii++, i += BEZIER_SIZE) {
+			for (int sample = 1; sample < QUANTIZE_CHECK_SAMPLES + BezierTable::SIZE / 2; sample++) {
+				float percent = sample < QUANTIZE_CHECK_SAMPLES ? (float) sample / QUANTIZE_CHECK_SAMPLES
+																: (_curves[i + (sample - QUANTIZE_CHECK_SAMPLES) * 2] - time1) / duration;
+				float expected = getBezierValue(time1 + percent * duration, frameIndex, 1 + ii, i);
+				float actual = getQuantizedValue(quantizedTime1 + percent * quantizedDuration, frame, ii);
+				if (!(MathUtil::abs(actual - expected) <= valueTolerance)) {
+					valid = false;
+					break;
+				}
+			}
+		}
+	}
+	_bezierSamples = bezierSamples;
+	if (!valid) {
+		_quantized = NULL;
+		delete quantized;
+		return 0;
+	}
+
+	for (size_t i = 0; i < quantized->beziers.size(); i++)
+		if (quantized->beziers[i]) quantized->beziers[i] = table.add(quantized->beziers[i]);
+	_frames.clear();
+	_frames.shrink();
+	_curves.clear();
+	_curves.shrink();
+	_bakedBeziers.clear();
+	_bakedBeziers.shrink();
+	_bezierSamples = 0;
+	quantized->memorySaved = memory - quantizedMemory;
+	return quantized->memorySaved;
+}
+
+size_t CurveTimeline::searchQuantized(float time) {
+	Quantized &quantized = *_quantized;
+	const unsigned short *frames = quantized.frames.buffer();
+	size_t step = getFrameEntries(), n = quantized.frameCount;
+	float start = quantized.timeStart, scale = quantized.timeScale;
+	if (n <= 8) {
+		for (size_t i = 1; i < n; i++)
+			if (dequantize(frames[i * step], start, scale) > time) return i - 1;
+		return n - 1;
+	}
+
+	size_t low = 1, high = n;
+	while (low < high) {
+		size_t middle = (low + high) >> 1;
+		if (dequantize(frames[middle * step], start, scale) > time) high = middle;
+		else
+			low = middle + 1;
+	}
+	return low - 1;
+}
+
+float CurveTimeline::getQuantizedValue(float time, size_t frame, size_t value) {
+	Quantized &quantized = *_quantized;
+	size_t frameEntries = getFrameEntries();
+	const unsigned short *frames = quantized.frames.buffer();
+	int curveType = frames[quantized.frameCount * frameEntries + frame];
+	frames += frame * frameEntries;
+	float valueStart = quantized.valueStart[value], valueScale = quantized.valueScale[value];
+	float value1 = dequantize(frames[1 + value], valueStart, valueScale);
+	if (curveType == STEPPED) return value1;
+
+	float value2 = dequantize(frames[frameEntries + 1 + value], valueStart, valueScale);
+	float time1 = dequantize(frames[0], quantized.timeStart, quantized.timeScale);
+	float x = (time - time1) / (dequantize(frames[frameEntries], quantized.timeStart, quantized.timeScale) - time1);
+	const short *curve = curveType == LINEAR ? NULL : quantized.beziers[curveType - BEZIER + value];
+	if (!curve) return value1 + x * (value2 - value1);
+
+	// Same as getBezierValue(), with the curve going from 0,0 to X_ONE,Y_ONE.
+	x *= BezierTable::X_ONE;
+	float y;
+	if (curve[0] > x)
+		y = x / curve[0] * curve[1];
+	else {
+		int i = 2;
+		while (i < BezierTable::SIZE && curve[i] < x) i += 2;
+		float x1 = curve[i - 2], y1 = curve[i - 1], x2 = BezierTable::X_ONE, y2 = BezierTable::Y_ONE;
+		if (i < BezierTable::SIZE) {
+			x2 = curve[i];
+			y2 = curve[i + 1];
+		}
+		y = x2 > x1 ? y1 + (x - x1) / (x2 - x1) * (y2 - y1) : y2;
+	}
+	return value1 + y * (1.0f / BezierTable::Y_ONE) * (value2 - value1);
+}
+
 RTTI_IMPL(CurveTimeline1, CurveTimeline)
 
 CurveTimeline1::CurveTimeline1(size_t frameCount, size_t bezierCount) : CurveTimeline(frameCount,
@@ -111,13 +414,9 @@ void CurveTimeline1::setFrame(size_t frame, float time, float value) {
 }
 
 float CurveTimeline1::getCurveValue(float time) {
-	int i = (int) _frames.size() - 2;
-	for (int ii = 2; ii <= i; ii += 2) {
-		if (_frames[ii] > time) {
-			i = ii - 2;
-			break;
-		}
-	}
+	if (_quantized) return getQuantizedValue(time, searchQuantized(time), 0);
+
+	int i = Animation::search(_frames, time, CurveTimeline1::ENTRIES);
 
 	int curveType = (int) _curves[i >> 1];
 	switch (curveType) {
@@ -132,8 +431,12 @@ float CurveTimeline1::getCurveValue(float time) {
 	return getBezierValue(time, i, CurveTimeline1::VALUE, curveType - CurveTimeline1::BEZIER);
 }
 
+size_t CurveTimeline1::quantize(float valueTolerance, float timeTolerance, BezierTable &table) {
+	return quantizeFrames(valueTolerance, timeTolerance, table);
+}
+
 float CurveTimeline1::getRelativeValue(float time, float alpha, MixBlend blend, float current, float setup) {
-	if (time < _frames[0]) {
+	if (time < getFirstTime()) {
 		switch (blend) {
 			case MixBlend_Setup:
 				return setup;
@@ -158,7 +461,7 @@ float CurveTimeline1::getRelativeValue(float time, float alpha, MixBlend blend,
 }
 
 float CurveTimeline1::getAbsoluteValue(float time, float alpha, MixBlend blend, float current, float setup) {
-	if (time < _frames[0]) {
+	if (time < getFirstTime()) {
 		switch (blend) {
 			case MixBlend_Setup:
 				return setup;
@@ -174,7 +477,7 @@ float CurveTimeline1::getAbsoluteValue(float time, float alpha, MixBlend blend,
 }
 
 float CurveTimeline1::getAbsoluteValue(float time, float alpha, MixBlend blend, float current, float setup, float value) {
-	if (time < _frames[0]) {
+	if (time < getFirstTime()) {
 		switch (blend) {
 			case MixBlend_Setup:
 				return setup;
@@ -190,7 +493,7 @@ float CurveTimeline1::getAbsoluteValue(float time, float alpha, MixBlend blend,
 
 float CurveTimeline1::getScaleValue(float time, float alpha, MixBlend blend, MixDirection direction, float current,
 									float setup) {
-	if (time < _frames[0]) {
+	if (time < getFirstTime()) {
 		switch (blend) {
 			case MixBlend_Setup:
 				return setup;
@@ -250,3 +553,40 @@ void CurveTimeline2::setFrame(size_t frame, float time, float value1, float valu
 	_frames[frame + CurveTimeline2::VALUE1] = value1;
 	_frames[frame + CurveTimeline2::VALUE2] = value2;
 }
+
+void CurveTimeline2::getCurveValue(float time, float &value1, float &value2) {
+	if (_quantized) {
+		size_t frame = searchQuantized(time);
+		value1 = getQuantizedValue(time, frame, 0);
+		value2 = getQuantizedValue(time, frame, 1);
+		return;
+	}
+
+	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES);
+	int curveType = (int) _curves[i / CurveTimeline2::ENTRIES];
+	switch (curveType) {
+		case CurveTimeline::LINEAR: {
+			float before = _frames[i];
+			value1 = _frames[i + CurveTimeline2::VALUE1];
+			value2 = _frames[i + CurveTimeline2::VALUE2];
+			float t = (time - before) / (_frames[i + CurveTimeline2::ENTRIES] - before);
+			value1 += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE1] - value1) * t;
+			value2 += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE2] - value2) * t;
+			break;
+		}
+		case CurveTimeline::STEPPED: {
+			value1 = _frames[i + CurveTimeline2::VALUE1];
+			value2 = _frames[i + CurveTimeline2::VALUE2];
+			break;
+		}
+		default: {
+			value1 = getBezierValue(time, i, CurveTimeline2::VALUE1, curveType - CurveTimeline::BEZIER);
+			value2 = getBezierValue(time, i, CurveTimeline2::VALUE2,
+									curveType + CurveTimeline::BEZIER_SIZE - CurveTimeline::BEZIER);
+		}
+	}
+}
+
+size_t CurveTimeline2::quantize(float valueTolerance, float timeTolerance, BezierTable &table) {
+	return quantizeFrames(valueTolerance, timeTolerance, table);
+}
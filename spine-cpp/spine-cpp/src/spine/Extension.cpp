@@ -28,9 +28,28 @@
  *****************************************************************************/
 
 #include <spine/Extension.h>
+#include <spine/Arena.h>
 #include <spine/SpineString.h>
 
 #include <assert.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#define SPINE_MAP_FILES
+#elif (defined(__unix__) || defined(__APPLE__)) && !defined(__EMSCRIPTEN__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SPINE_MAP_FILES
+#endif
 
 using namespace spine;
 
@@ -52,9 +71,52 @@ SpineExtension *SpineExtension::getInstance() {
 SpineExtension::~SpineExtension() {
 }
 
+void *SpineExtension::allocBytes(size_t size, bool clear, const char *file, int line) {
+	Arena *arena = Arena::getCurrent();
+	if (arena) return arena->alloc(size, clear);
+	return clear ? getInstance()->_calloc(size, file, line) : getInstance()->_alloc(size, file, line);
+}
+
+void *SpineExtension::reallocBytes(void *ptr, size_t size, const char *file, int line) {
+	// Memory stays where it was allocated, only new allocations go to the arena. Memory owned by an arena that isn't
+	// current moves to a new allocation, as that arena may be allocated from on another thread.
+	Arena *arena = Arena::getCurrent();
+	if (arena && (!ptr || arena->owns(ptr))) return arena->realloc(ptr, size);
+	Arena *owner = Arena::findOwner(ptr);
+	if (owner) {
+		void *newPtr = allocBytes(size, false, file, line);
+		size_t oldSize = Arena::getAllocationSize(ptr);
+		if (newPtr) memcpy(newPtr, ptr, oldSize < size ? oldSize : size);
+		owner->free(ptr);
+		return newPtr;
+	}
+	return getInstance()->_realloc(ptr, size, file, line);
+}
+
+void SpineExtension::freeBytes(void *ptr, const char *file, int line) {
+	Arena *arena = Arena::getCurrent();
+	if (!arena || !arena->owns(ptr)) arena = Arena::findOwner(ptr);
+	if (arena) {
+		arena->free(ptr);
+		return;
+	}
+	getInstance()->_free(ptr, file, line);
+}
+
 SpineExtension::SpineExtension() {
 }
 
+const char *SpineExtension::_mapFile(const String &path, int *length) {
+	SP_UNUSED(path);
+	SP_UNUSED(length);
+	return NULL;
+}
+
+void SpineExtension::_unmapFile(const char *data, int length) {
+	SP_UNUSED(data);
+	SP_UNUSED(length);
+}
+
 DefaultSpineExtension::~DefaultSpineExtension() {
 }
 
@@ -123,5 +185,54 @@ char *DefaultSpineExtension::_readFile(const String &path, int *length) {
 #endif
 }
 
+const char *DefaultSpineExtension::_mapFile(const String &path, int *length) {
+#if defined(SPINE_MAP_FILES) && defined(_WIN32)
+	HANDLE file = CreateFileA(path.buffer(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) return NULL;
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0 || size.QuadPart > 0x7fffffff) {
+		CloseHandle(file);
+		return NULL;
+	}
+	HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file);
+	if (!mapping) return NULL;
+	void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (!data) return NULL;
+	*length = (int) size.QuadPart;
+	return (const char *) data;
+#elif defined(SPINE_MAP_FILES)
+	int file = open(path.buffer(), O_RDONLY);
+	if (file == -1) return NULL;
+	struct stat info;
+	if (fstat(file, &info) != 0 || info.st_size == 0 || info.st_size > 0x7fffffff) {
+		close(file);
+		return NULL;
+	}
+	void *data = mmap(NULL, (size_t) info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+	close(file);
+	if (data == MAP_FAILED) return NULL;
+	*length = (int) info.st_size;
+	return (const char *) data;
+#else
+	SP_UNUSED(path);
+	SP_UNUSED(length);
+	return NULL;
+#endif
+}
+
+void DefaultSpineExtension::_unmapFile(const char *data, int length) {
+#if defined(SPINE_MAP_FILES) && defined(_WIN32)
+	SP_UNUSED(length);
+	UnmapViewOfFile(data);
+#elif defined(SPINE_MAP_FILES)
+	munmap((void *) data, (size_t) length);
+#else
+	SP_UNUSED(data);
+	SP_UNUSED(length);
+#endif
+}
+
 DefaultSpineExtension::DefaultSpineExtension() : SpineExtension() {
 }
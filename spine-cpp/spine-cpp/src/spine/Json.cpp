@@ -35,11 +35,13 @@ THE SOFTWARE.
 #endif
 
 #include <spine/Json.h>
+#include <spine/Arena.h>
 #include <spine/Extension.h>
 #include <spine/SpineString.h>
 
 #include <assert.h>
 #include <math.h>
+#include <stdint.h>
 
 using namespace spine;
 
@@ -51,14 +53,17 @@ const int Json::JSON_STRING = 4;
 const int Json::JSON_ARRAY = 5;
 const int Json::JSON_OBJECT = 6;
 
-const char *Json::_error = NULL;
+// Parse errors are tracked per thread, so skeletons can be loaded on several threads at once.
+static thread_local const char *_error = NULL;
 
 Json *Json::getItem(Json *object, const char *string) {
-	Json *c = object->_child;
-	while (c && json_strcasecmp(c->_name, string)) {
-		c = c->_next;
+	/* Names whose first characters differ ignoring case can't match, only call json_strcasecmp() for the others. */
+	const int first = string[0] | 0x20;
+	for (Json *c = object->_child; c; c = c->_next) {
+		if (c->_name && (c->_name[0] | 0x20) != first) continue;
+		if (!json_strcasecmp(c->_name, string)) return c;
 	}
-	return c;
+	return NULL;
 }
 
 Json *Json::getItem(Json *object, int childIndex) {
@@ -117,8 +122,12 @@ Json::Json(const char *value) : _next(NULL),
 								_valueString(NULL),
 								_valueInt(0),
 								_valueFloat(0),
-								_name(NULL) {
+								_name(NULL),
+								_arena(NULL) {
 	if (value) {
+		/* Items are only created while parsing, so they and their strings all go into the root's arena. */
+		_arena = new (__FILE__, __LINE__) Arena();
+		ArenaScope arenaScope(_arena);
 		value = parseValue(this, skip(value));
 
 		assert(value);
@@ -126,6 +135,12 @@ Json::Json(const char *value) : _next(NULL),
 }
 
 Json::~Json() {
+	if (_arena) {
+		/* The items and strings of the tree don't own anything outside the arena. */
+		delete _arena;
+		return;
+	}
+
 	spine::Json *curr = NULL;
 	spine::Json *next = _child;
 	do {
@@ -218,6 +233,36 @@ const char *Json::parseValue(Json *item, const char *value) {
 	return NULL; /* failure. */
 }
 
+static const double powersOf10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+									 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+/* Exact for the exponents in the table, so it gives the same result as pow(). */
+static double powerOf10(double exponent) {
+	if (exponent <= 22) return powersOf10[(int) exponent];
+	return pow(10.0, exponent);
+}
+
+/* Accumulates digits like result = result * 10 + digit in double arithmetic would. The first 15 digits are accumulated
+ * as an integer, which is exact and so gives the same result. */
+static const char *parseDigits(const char *ptr, double *result, int *count) {
+	uint64_t digits = 0;
+	int n = 0;
+	while (*ptr >= '0' && *ptr <= '9' && n < 15) {
+		digits = digits * 10 + (*ptr - '0');
+		++ptr;
+		++n;
+	}
+	double value = (double) digits;
+	while (*ptr >= '0' && *ptr <= '9') {
+		value = value * 10.0 + (*ptr - '0');
+		++ptr;
+		++n;
+	}
+	*result = value;
+	*count = n;
+	return ptr;
+}
+
 static const unsigned char firstByteMark[7] = {0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC};
 
 const char *Json::parseString(Json *item, const char *str) {
@@ -340,29 +385,22 @@ const char *Json::parseString(Json *item, const char *str) {
 const char *Json::parseNumber(Json *item, const char *num) {
 	double result = 0.0;
 	int negative = 0;
-	char *ptr = (char *) num;
+	int n = 0;
+	const char *ptr = num;
 
 	if (*ptr == '-') {
 		negative = -1;
 		++ptr;
 	}
 
-	while (*ptr >= '0' && *ptr <= '9') {
-		result = result * 10.0 + (*ptr - '0');
-		++ptr;
-	}
+	ptr = parseDigits(ptr, &result, &n);
 
 	if (*ptr == '.') {
 		double fraction = 0.0;
-		int n = 0;
 		++ptr;
 
-		while (*ptr >= '0' && *ptr <= '9') {
-			fraction = (fraction * 10.0) + (*ptr - '0');
-			++ptr;
-			++n;
-		}
-		result += fraction / pow(10.0, n);
+		ptr = parseDigits(ptr, &fraction, &n);
+		result += fraction / powerOf10(n);
 	}
 
 	if (negative) {
@@ -387,9 +425,9 @@ const char *Json::parseNumber(Json *item, const char *num) {
 		}
 
 		if (expNegative) {
-			result = result / pow(10, exponent);
+			result = result / powerOf10(exponent);
 		} else {
-			result = result * pow(10, exponent);
+			result = result * powerOf10(exponent);
 		}
 	}
 
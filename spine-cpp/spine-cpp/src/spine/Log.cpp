@@ -52,6 +52,12 @@ void _spDebug_printTimelineBase(Timeline *timeline) {
 }
 
 void _spDebug_printCurveTimeline(CurveTimeline *timeline) {
+	if (timeline->isQuantized()) {
+		printf("   Timeline %s:\n", timeline->getRTTI().getClassName());
+		printf("      frame count: %zu\n", timeline->getFrameCount());
+		printf("      quantized, %zu bytes saved\n", timeline->getQuantizedMemorySaved());
+		return;
+	}
 	_spDebug_printTimelineBase(timeline);
 	printf("      curves: ");
 	spDebug_printFloats(timeline->getCurves());
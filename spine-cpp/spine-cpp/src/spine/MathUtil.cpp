@@ -30,12 +30,22 @@
 #include <spine/MathUtil.h>
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
 
 // Required for division by 0 in _isNaN on MSVC
 #ifdef _MSC_VER
 #pragma warning(disable : 4723)
 #endif
 
+#if defined(SPINE_FAST_TRIG) && !defined(SPINE_NO_SIMD) && \
+		(defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+#include <xmmintrin.h>
+#define SPINE_SIMD_SSE
+#elif defined(SPINE_FAST_TRIG) && !defined(SPINE_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define SPINE_SIMD_NEON
+#endif
+
 using namespace spine;
 
 const float MathUtil::Pi = 3.1415926535897932385f;
@@ -71,14 +81,165 @@ float MathUtil::atan2Deg(float y, float x) {
 	return MathUtil::atan2(y, x) * MathUtil::Rad_Deg;
 }
 
-/// Returns the cosine in radians from a lookup table.
+#ifdef SPINE_FAST_TRIG
+// The angle is reduced to r in [-pi/4, pi/4] and the quadrant q, with pi/2 split in 3 parts so k * part is exact.
+// Rounding adds and subtracts 1.5 * 2^23, which leaves no fraction for floats below 2^22.
+static const float trigRound = 12582912.0f;
+static const float trig2_Pi = 0.636619772367581343f;
+static const float trigPi_2a = 1.5703125f;
+static const float trigPi_2b = 4.837512969970703125e-4f;
+static const float trigPi_2c = 7.54978995489188216e-8f;
+// Minimax polynomials for sin and cos in [-pi/4, pi/4].
+static const float trigSin1 = -1.6666654611e-1f;
+static const float trigSin2 = 8.3321608736e-3f;
+static const float trigSin3 = -1.9515295891e-4f;
+static const float trigCos1 = 4.166664568298827e-2f;
+static const float trigCos2 = -1.388731625493765e-3f;
+static const float trigCos3 = 2.443315711809948e-5f;
+
+static inline unsigned int floatBits(float value) {
+	unsigned int bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+static inline float bitsFloat(unsigned int bits) {
+	float value;
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+// Uses the same operations as sinCos4(), so single and batched results are equal. The quadrant selects and negates
+// the results with bit masks, as branches on it are unpredictable.
+static inline void fastSinCos(float radians, float &outSin, float &outCos) {
+	float k = (radians * trig2_Pi + trigRound) - trigRound;
+	float r = ((radians - k * trigPi_2a) - k * trigPi_2b) - k * trigPi_2c;
+	float q = k - 4 * (((k - 1.5f) * 0.25f + trigRound) - trigRound);
+	float z = r * r;
+	unsigned int s = floatBits(((trigSin3 * z + trigSin2) * z + trigSin1) * z * r + r);
+	unsigned int c = floatBits(((trigCos3 * z + trigCos2) * z + trigCos1) * z * z - 0.5f * z + 1);
+	unsigned int swap = 0u - (unsigned int) ((q == 1) | (q == 3));
+	outSin = bitsFloat(((c & swap) | (s & ~swap)) ^ ((unsigned int) (q >= 2) << 31));
+	outCos = bitsFloat(((s & swap) | (c & ~swap)) ^ ((unsigned int) ((q == 1) | (q == 2)) << 31));
+}
+
+#if defined(SPINE_SIMD_SSE) || defined(SPINE_SIMD_NEON)
+// fastSinCos() for 4 angles.
+static void sinCos4(const float *radians, float *outSin, float *outCos) {
+#ifdef SPINE_SIMD_SSE
+	__m128 round = _mm_set1_ps(trigRound), x = _mm_loadu_ps(radians);
+	__m128 k = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(trig2_Pi)), round), round);
+	__m128 r = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(x, _mm_mul_ps(k, _mm_set1_ps(trigPi_2a))),
+										_mm_mul_ps(k, _mm_set1_ps(trigPi_2b))),
+						  _mm_mul_ps(k, _mm_set1_ps(trigPi_2c)));
+	__m128 m = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(k, _mm_set1_ps(1.5f)), _mm_set1_ps(0.25f)), round), round);
+	__m128 q = _mm_sub_ps(k, _mm_mul_ps(_mm_set1_ps(4), m));
+	__m128 z = _mm_mul_ps(r, r);
+	__m128 s = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(trigSin3), z),
+																			_mm_set1_ps(trigSin2)),
+															   z),
+													_mm_set1_ps(trigSin1)),
+										 z),
+							  r),
+				   r);
+	__m128 c = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(trigCos3), z),
+																				   _mm_set1_ps(trigCos2)),
+																	  z),
+														   _mm_set1_ps(trigCos1)),
+												z),
+									 z),
+						  _mm_mul_ps(_mm_set1_ps(0.5f), z)),
+				   _mm_set1_ps(1));
+	__m128 q1 = _mm_cmpeq_ps(q, _mm_set1_ps(1)), q2 = _mm_cmpeq_ps(q, _mm_set1_ps(2));
+	__m128 swap = _mm_or_ps(q1, _mm_cmpeq_ps(q, _mm_set1_ps(3)));
+	__m128 sign = _mm_set1_ps(-0.0f);
+	__m128 sinValue = _mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s));
+	__m128 cosValue = _mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c));
+	_mm_storeu_ps(outSin, _mm_xor_ps(sinValue, _mm_and_ps(_mm_cmpge_ps(q, _mm_set1_ps(2)), sign)));
+	_mm_storeu_ps(outCos, _mm_xor_ps(cosValue, _mm_and_ps(_mm_or_ps(q1, q2), sign)));
+#else
+	float32x4_t round = vdupq_n_f32(trigRound), x = vld1q_f32(radians);
+	float32x4_t k = vsubq_f32(vaddq_f32(vmulq_f32(x, vdupq_n_f32(trig2_Pi)), round), round);
+	float32x4_t r = vsubq_f32(vsubq_f32(vsubq_f32(x, vmulq_f32(k, vdupq_n_f32(trigPi_2a))),
+										vmulq_f32(k, vdupq_n_f32(trigPi_2b))),
+							  vmulq_f32(k, vdupq_n_f32(trigPi_2c)));
+	float32x4_t m = vsubq_f32(vaddq_f32(vmulq_f32(vsubq_f32(k, vdupq_n_f32(1.5f)), vdupq_n_f32(0.25f)), round), round);
+	float32x4_t q = vsubq_f32(k, vmulq_f32(vdupq_n_f32(4), m));
+	float32x4_t z = vmulq_f32(r, r);
+	float32x4_t s = vaddq_f32(vmulq_f32(vmulq_f32(vaddq_f32(vmulq_f32(vaddq_f32(vmulq_f32(vdupq_n_f32(trigSin3), z),
+																			  vdupq_n_f32(trigSin2)),
+																	z),
+														  vdupq_n_f32(trigSin1)),
+												z),
+									  r),
+							  r);
+	float32x4_t c = vaddq_f32(vsubq_f32(vmulq_f32(vmulq_f32(vaddq_f32(vmulq_f32(vaddq_f32(vmulq_f32(vdupq_n_f32(trigCos3), z),
+																						vdupq_n_f32(trigCos2)),
+																			  z),
+																	vdupq_n_f32(trigCos1)),
+														  z),
+												z),
+									  vmulq_f32(vdupq_n_f32(0.5f), z)),
+							  vdupq_n_f32(1));
+	uint32x4_t q1 = vceqq_f32(q, vdupq_n_f32(1)), q2 = vceqq_f32(q, vdupq_n_f32(2));
+	uint32x4_t swap = vorrq_u32(q1, vceqq_f32(q, vdupq_n_f32(3)));
+	uint32x4_t sign = vdupq_n_u32(0x80000000);
+	float32x4_t sinValue = vbslq_f32(swap, c, s), cosValue = vbslq_f32(swap, s, c);
+	vst1q_f32(outSin, vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(sinValue),
+													 vandq_u32(vcgeq_f32(q, vdupq_n_f32(2)), sign))));
+	vst1q_f32(outCos, vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(cosValue), vandq_u32(vorrq_u32(q1, q2), sign))));
+#endif
+}
+#endif
+#endif
+
+void MathUtil::sinCos(float radians, float &outSin, float &outCos) {
+#if defined(SPINE_FAST_TRIG)
+	fastSinCos(radians, outSin, outCos);
+#elif defined(SPINE_FLOAT_TRIG)
+	outSin = ::sinf(radians);
+	outCos = ::cosf(radians);
+#else
+	// Computing both from the same argument lets compilers use a single sincos call.
+	outSin = (float) ::sin(radians);
+	outCos = (float) ::cos(radians);
+#endif
+}
+
+void MathUtil::sinCos(const float *radians, float *outSin, float *outCos, size_t count) {
+	size_t i = 0;
+#if defined(SPINE_SIMD_SSE) || defined(SPINE_SIMD_NEON)
+	for (; i + 4 <= count; i += 4)
+		sinCos4(radians + i, outSin + i, outCos + i);
+#endif
+	for (; i < count; i++) {
+		float radiansValue = radians[i];
+		sinCos(radiansValue, outSin[i], outCos[i]);
+	}
+}
+
 float MathUtil::cos(float radians) {
+#if defined(SPINE_FAST_TRIG)
+	float sin, cos;
+	fastSinCos(radians, sin, cos);
+	return cos;
+#elif defined(SPINE_FLOAT_TRIG)
+	return ::cosf(radians);
+#else
 	return (float) ::cos(radians);
+#endif
 }
 
-/// Returns the sine in radians from a lookup table.
 float MathUtil::sin(float radians) {
+#if defined(SPINE_FAST_TRIG)
+	float sin, cos;
+	fastSinCos(radians, sin, cos);
+	return sin;
+#elif defined(SPINE_FLOAT_TRIG)
+	return ::sinf(radians);
+#else
 	return (float) ::sin(radians);
+#endif
 }
 
 float MathUtil::sqrt(float v) {
@@ -89,14 +250,12 @@ float MathUtil::acos(float v) {
 	return (float) ::acos(v);
 }
 
-/// Returns the sine in radians from a lookup table.
 float MathUtil::sinDeg(float degrees) {
-	return (float) ::sin(degrees * MathUtil::Deg_Rad);
+	return sin(degrees * MathUtil::Deg_Rad);
 }
 
-/// Returns the cosine in radians from a lookup table.
 float MathUtil::cosDeg(float degrees) {
-	return (float) ::cos(degrees * MathUtil::Deg_Rad);
+	return cos(degrees * MathUtil::Deg_Rad);
 }
 
 /* Need to pass 0 as an argument, so VC++ doesn't error with C2124 */
@@ -131,3 +290,7 @@ float MathUtil::pow(float a, float b) {
 float MathUtil::ceil(float v) {
 	return ::ceil(v);
 }
+
+float MathUtil::floor(float v) {
+	return ::floor(v);
+}
@@ -29,6 +29,8 @@
 
 #include <spine/MeshAttachment.h>
 
+#include <float.h>
+
 using namespace spine;
 
 RTTI_IMPL(MeshAttachment, VertexAttachment)
@@ -114,6 +116,57 @@ void MeshAttachment::updateRegion() {
 	}
 }
 
+void MeshAttachment::updateBounds() {
+	_boundsBones.clear();
+	_bounds.clear();
+	if (_vertices.size() == 0) return;
+	if (_bones.size() == 0) {
+		float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+		for (size_t i = 0, n = _vertices.size(); i < n; i += 2) {
+			minX = MathUtil::min(minX, _vertices[i]);
+			minY = MathUtil::min(minY, _vertices[i + 1]);
+			maxX = MathUtil::max(maxX, _vertices[i]);
+			maxY = MathUtil::max(maxY, _vertices[i + 1]);
+		}
+		_bounds.add(minX);
+		_bounds.add(minY);
+		_bounds.add(maxX);
+		_bounds.add(maxY);
+		return;
+	}
+
+	// A weighted vertex is a weighted average of its positions in each bone's space, so it lies within the union of
+	// the bounds of those positions.
+	for (size_t v = 0, b = 0, n = _bones.size(); v < n;) {
+		int count = _bones[v++];
+		for (int i = 0; i < count; i++, v++, b += 3) {
+			int index = _boundsBones.indexOf(_bones[v]);
+			if (index == -1) {
+				index = (int) _boundsBones.size();
+				_boundsBones.add(_bones[v]);
+				_bounds.add(FLT_MAX);
+				_bounds.add(FLT_MAX);
+				_bounds.add(-FLT_MAX);
+				_bounds.add(-FLT_MAX);
+			}
+			float *bounds = _bounds.buffer() + index * 4;
+			float x = _vertices[b], y = _vertices[b + 1];
+			bounds[0] = MathUtil::min(bounds[0], x);
+			bounds[1] = MathUtil::min(bounds[1], y);
+			bounds[2] = MathUtil::max(bounds[2], x);
+			bounds[3] = MathUtil::max(bounds[3], y);
+		}
+	}
+}
+
+Vector<int> &MeshAttachment::getBoundsBones() {
+	return _boundsBones;
+}
+
+Vector<float> &MeshAttachment::getBounds() {
+	return _bounds;
+}
+
 int MeshAttachment::getHullLength() {
 	return _hullLength;
 }
@@ -167,6 +220,8 @@ void MeshAttachment::setParentMesh(MeshAttachment *inValue) {
 	if (inValue != NULL) {
 		_bones.clearAndAddAll(inValue->_bones);
 		_vertices.clearAndAddAll(inValue->_vertices);
+		_boundsBones.clearAndAddAll(inValue->_boundsBones);
+		_bounds.clearAndAddAll(inValue->_bounds);
 		_worldVerticesLength = inValue->_worldVerticesLength;
 		_regionUVs.clearAndAddAll(inValue->_regionUVs);
 		_triangles.clearAndAddAll(inValue->_triangles);
@@ -211,6 +266,8 @@ Attachment *MeshAttachment::copy() {
 	copy->_color.set(_color);
 
 	copyTo(copy);
+	copy->_boundsBones.clearAndAddAll(_boundsBones);
+	copy->_bounds.clearAndAddAll(_bounds);
 	copy->_regionUVs.clearAndAddAll(_regionUVs);
 	copy->_uvs.clearAndAddAll(_uvs);
 	copy->_triangles.clearAndAddAll(_triangles);
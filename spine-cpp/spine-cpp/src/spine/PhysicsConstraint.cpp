@@ -385,15 +385,13 @@ void PhysicsConstraint::update(Physics physics) {
 						float r = MathUtil::atan2(dy + _ty, dx + _tx) - ca - _rotateOffset * mr;
 						_rotateOffset += (r - MathUtil::ceil(r * MathUtil::InvPi_2 - 0.5f) * MathUtil::Pi_2) * i;
 						r = _rotateOffset * mr + ca;
-						c = MathUtil::cos(r);
-						s = MathUtil::sin(r);
+						MathUtil::sinCos(r, s, c);
 						if (scaleX) {
 							r = l * bone->getWorldScaleX();
 							if (r > 0) _scaleOffset += (dx * c + dy * s) * i / r;
 						}
 					} else {
-						c = MathUtil::cos(ca);
-						s = MathUtil::sin(ca);
+						MathUtil::sinCos(ca, s, c);
 						float r = l * bone->getWorldScaleX();
 						if (r > 0) _scaleOffset += (dx * c + dy * s) * i / r;
 					}
@@ -414,8 +412,7 @@ void PhysicsConstraint::update(Physics physics) {
 								_rotateVelocity *= d;
 								if (a < t) break;
 								float r = _rotateOffset * mr + ca;
-								c = MathUtil::cos(r);
-								s = MathUtil::sin(r);
+								MathUtil::sinCos(r, s, c);
 							} else if (a < t)//
 								break;
 						}
@@ -441,22 +438,19 @@ void PhysicsConstraint::update(Physics physics) {
 			float r = 0;
 			if (_data._rotate > 0) {
 				r = o * _data._rotate;
-				s = MathUtil::sin(r);
-				c = MathUtil::cos(r);
+				MathUtil::sinCos(r, s, c);
 				a = bone->_b;
 				bone->_b = c * a - s * bone->_d;
 				bone->_d = s * a + c * bone->_d;
 			}
 			r += o * _data._shearX;
-			s = MathUtil::sin(r);
-			c = MathUtil::cos(r);
+			MathUtil::sinCos(r, s, c);
 			a = bone->_a;
 			bone->_a = c * a - s * bone->_c;
 			bone->_c = s * a + c * bone->_c;
 		} else {
 			o *= _data._rotate;
-			s = MathUtil::sin(o);
-			c = MathUtil::cos(o);
+			MathUtil::sinCos(o, s, c);
 			a = bone->_a;
 			bone->_a = c * a - s * bone->_c;
 			bone->_c = s * a + c * bone->_c;
@@ -478,7 +472,8 @@ void PhysicsConstraint::update(Physics physics) {
 }
 
 void PhysicsConstraint::rotate(float x, float y, float degrees) {
-	float r = degrees * MathUtil::Deg_Rad, cos = MathUtil::cos(r), sin = MathUtil::sin(r);
+	float r = degrees * MathUtil::Deg_Rad, sin, cos;
+	MathUtil::sinCos(r, sin, cos);
 	float dx = _cx - x, dy = _cy - y;
 	translate(dx * cos - dy * sin - dx, dx * sin + dy * cos - dy);
 }
@@ -61,7 +61,7 @@ PhysicsConstraintTimeline::PhysicsConstraintTimeline(size_t frameCount, size_t b
 void PhysicsConstraintTimeline::apply(Skeleton &skeleton, float, float time, Vector<Event *> *,
 									  float alpha, MixBlend blend, MixDirection) {
 	if (_constraintIndex == -1) {
-		float value = time >= _frames[0] ? getCurveValue(time) : 0;
+		float value = time >= getFirstTime() ? getCurveValue(time) : 0;
 
 		Vector<PhysicsConstraint *> &physicsConstraints = skeleton.getPhysicsConstraints();
 		for (size_t i = 0; i < physicsConstraints.size(); i++) {
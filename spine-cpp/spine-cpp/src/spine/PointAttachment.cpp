@@ -45,7 +45,8 @@ void PointAttachment::computeWorldPosition(Bone &bone, float &ox, float &oy) {
 }
 
 float PointAttachment::computeWorldRotation(Bone &bone) {
-	float r = _rotation * MathUtil::Deg_Rad, cosine = MathUtil::cos(r), sine = MathUtil::sin(r);
+	float r = _rotation * MathUtil::Deg_Rad, sine, cosine;
+	MathUtil::sinCos(r, sine, cosine);
 	float x = cosine * bone._a + sine * bone._b;
 	float y = cosine * bone._c + sine * bone._d;
 	return MathUtil::atan2Deg(y, x);
@@ -86,8 +86,8 @@ void RegionAttachment::updateRegion() {
 	float localY = -_height / 2 * _scaleY + _region->offsetY * regionScaleY;
 	float localX2 = localX + _region->width * regionScaleX;
 	float localY2 = localY + _region->height * regionScaleY;
-	float cos = MathUtil::cosDeg(_rotation);
-	float sin = MathUtil::sinDeg(_rotation);
+	float sin, cos;
+	MathUtil::sinCos(_rotation * MathUtil::Deg_Rad, sin, cos);
 	float localXCos = localX * cos + _x;
 	float localXSin = localX * sin;
 	float localYCos = localY * cos + _y;
@@ -61,7 +61,7 @@ void ShearTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	Bone *bone = skeleton._bones[_boneIndex];
 	if (!bone->_active) return;
 
-	if (time < _frames[0]) {
+	if (time < getFirstTime()) {
 		switch (blend) {
 			case MixBlend_Setup:
 				bone->_shearX = bone->_data._shearX;
@@ -77,29 +77,7 @@ void ShearTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	}
 
 	float x, y;
-	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES);
-	int curveType = (int) _curves[i / CurveTimeline2::ENTRIES];
-	switch (curveType) {
-		case CurveTimeline2::LINEAR: {
-			float before = _frames[i];
-			x = _frames[i + CurveTimeline2::VALUE1];
-			y = _frames[i + CurveTimeline2::VALUE2];
-			float t = (time - before) / (_frames[i + CurveTimeline2::ENTRIES] - before);
-			x += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE1] - x) * t;
-			y += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE2] - y) * t;
-			break;
-		}
-		case CurveTimeline2::STEPPED: {
-			x = _frames[i + CurveTimeline2::VALUE1];
-			y = _frames[i + CurveTimeline2::VALUE2];
-			break;
-		}
-		default: {
-			x = getBezierValue(time, i, CurveTimeline2::VALUE1, curveType - CurveTimeline2::BEZIER);
-			y = getBezierValue(time, i, CurveTimeline2::VALUE2,
-							   curveType + CurveTimeline2::BEZIER_SIZE - CurveTimeline2::BEZIER);
-		}
-	}
+	getCurveValue(time, x, y);
 
 	switch (blend) {
 		case MixBlend_Setup:
@@ -50,28 +50,67 @@
 #include <spine/SlotData.h>
 #include <spine/TransformConstraintData.h>
 #include <spine/SkeletonClipping.h>
+#include <spine/UpdateCacheTemplate.h>
 
 #include <spine/ContainerUtil.h>
 
 #include <float.h>
 
+#if !defined(SPINE_NO_SIMD) && (defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+#include <xmmintrin.h>
+#define SPINE_SIMD_SSE
+#elif !defined(SPINE_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define SPINE_SIMD_NEON
+#endif
+
 using namespace spine;
 
+// Objects placed in the skeleton's memory keep the 16 byte alignment of allocations.
+template<typename T>
+static inline size_t placementSize(size_t count) {
+	return ((sizeof(T) + 15) & ~(size_t) 15) * count;
+}
+
+// Stores the constraints at their order. Called for the constraint types from last to first and for each type's
+// constraints in reverse, so for an order used more than once the first IK, transform, path, then physics constraint is
+// kept, as updateCache() used to find them.
+template<typename T>
+static void setConstraintOrder(Vector<Updatable *> &order, Vector<T *> &constraints) {
+	for (size_t i = constraints.size(); i > 0; i--) {
+		T *constraint = constraints[i - 1];
+		size_t index = constraint->getData().getOrder();
+		if (index < order.size()) order[index] = constraint;
+	}
+}
+
 Skeleton::Skeleton(SkeletonData *skeletonData)
-	: _data(skeletonData), _skin(NULL), _color(1, 1, 1, 1), _scaleX(1),
-	  _scaleY(1), _x(0), _y(0), _time(0) {
+	: _data(skeletonData), _memory(NULL), _usePoseBuffer(false), _skin(NULL), _color(1, 1, 1, 1), _scaleX(1),
+	  _scaleY(1), _x(0), _y(0), _time(0), _attachmentCacheSkin(NULL), _attachmentCacheDefaultSkin(NULL),
+	  _attachmentCacheVersion(0) {
+	// Bones, slots and constraints are placed in a single allocation sized from the data, instead of allocating each
+	// of them separately.
+	size_t size = placementSize<Bone>(_data->getBones().size()) + placementSize<Slot>(_data->getSlots().size()) +
+				  placementSize<IkConstraint>(_data->getIkConstraints().size()) +
+				  placementSize<TransformConstraint>(_data->getTransformConstraints().size()) +
+				  placementSize<PathConstraint>(_data->getPathConstraints().size()) +
+				  placementSize<PhysicsConstraint>(_data->getPhysicsConstraints().size());
+	_memory = SpineExtension::alloc<char>(size, __FILE__, __LINE__);
+	char *memory = _memory;
+
 	_bones.ensureCapacity(_data->getBones().size());
 	for (size_t i = 0; i < _data->getBones().size(); ++i) {
 		BoneData *data = _data->getBones()[i];
 
 		Bone *bone;
 		if (data->getParent() == NULL) {
-			bone = new (__FILE__, __LINE__) Bone(*data, *this, NULL);
+			bone = new (memory) Bone(*data, *this, NULL);
 		} else {
 			Bone *parent = _bones[data->getParent()->getIndex()];
-			bone = new (__FILE__, __LINE__) Bone(*data, *this, parent);
+			bone = new (memory) Bone(*data, *this, parent);
 			parent->getChildren().add(bone);
 		}
+		memory += placementSize<Bone>(1);
 
 		_bones.add(bone);
 	}
@@ -82,7 +121,8 @@ Skeleton::Skeleton(SkeletonData *skeletonData)
 		SlotData *data = _data->getSlots()[i];
 
 		Bone *bone = _bones[data->getBoneData().getIndex()];
-		Slot *slot = new (__FILE__, __LINE__) Slot(*data, *bone);
+		Slot *slot = new (memory) Slot(*data, *bone);
+		memory += placementSize<Slot>(1);
 
 		_slots.add(slot);
 		_drawOrder.add(slot);
@@ -92,8 +132,8 @@ Skeleton::Skeleton(SkeletonData *skeletonData)
 	for (size_t i = 0; i < _data->getIkConstraints().size(); ++i) {
 		IkConstraintData *data = _data->getIkConstraints()[i];
 
-		IkConstraint *constraint =
-				new (__FILE__, __LINE__) IkConstraint(*data, *this);
+		IkConstraint *constraint = new (memory) IkConstraint(*data, *this);
+		memory += placementSize<IkConstraint>(1);
 
 		_ikConstraints.add(constraint);
 	}
@@ -102,8 +142,8 @@ Skeleton::Skeleton(SkeletonData *skeletonData)
 	for (size_t i = 0; i < _data->getTransformConstraints().size(); ++i) {
 		TransformConstraintData *data = _data->getTransformConstraints()[i];
 
-		TransformConstraint *constraint =
-				new (__FILE__, __LINE__) TransformConstraint(*data, *this);
+		TransformConstraint *constraint = new (memory) TransformConstraint(*data, *this);
+		memory += placementSize<TransformConstraint>(1);
 
 		_transformConstraints.add(constraint);
 	}
@@ -112,8 +152,8 @@ Skeleton::Skeleton(SkeletonData *skeletonData)
 	for (size_t i = 0; i < _data->getPathConstraints().size(); ++i) {
 		PathConstraintData *data = _data->getPathConstraints()[i];
 
-		PathConstraint *constraint =
-				new (__FILE__, __LINE__) PathConstraint(*data, *this);
+		PathConstraint *constraint = new (memory) PathConstraint(*data, *this);
+		memory += placementSize<PathConstraint>(1);
 
 		_pathConstraints.add(constraint);
 	}
@@ -122,25 +162,46 @@ Skeleton::Skeleton(SkeletonData *skeletonData)
 	for (size_t i = 0; i < _data->getPhysicsConstraints().size(); ++i) {
 		PhysicsConstraintData *data = _data->getPhysicsConstraints()[i];
 
-		PhysicsConstraint *constraint =
-				new (__FILE__, __LINE__) PhysicsConstraint(*data, *this);
+		PhysicsConstraint *constraint = new (memory) PhysicsConstraint(*data, *this);
+		memory += placementSize<PhysicsConstraint>(1);
 
 		_physicsConstraints.add(constraint);
 	}
 
+	_constraintOrder.setSize(_ikConstraints.size() + _transformConstraints.size() + _pathConstraints.size() +
+									 _physicsConstraints.size(),
+							 NULL);
+	setConstraintOrder(_constraintOrder, _physicsConstraints);
+	setConstraintOrder(_constraintOrder, _pathConstraints);
+	setConstraintOrder(_constraintOrder, _transformConstraints);
+	setConstraintOrder(_constraintOrder, _ikConstraints);
+
 	updateCache();
 }
 
+// Destroys objects placed in the skeleton's memory, which is freed separately.
+template<typename T>
+static void destroyPlaced(Vector<T *> &items) {
+	for (size_t i = 0, n = items.size(); i < n; ++i)
+		items[i]->~T();
+	items.clear();
+}
+
 Skeleton::~Skeleton() {
-	ContainerUtil::cleanUpVectorOfPointers(_bones);
-	ContainerUtil::cleanUpVectorOfPointers(_slots);
-	ContainerUtil::cleanUpVectorOfPointers(_ikConstraints);
-	ContainerUtil::cleanUpVectorOfPointers(_transformConstraints);
-	ContainerUtil::cleanUpVectorOfPointers(_pathConstraints);
-	ContainerUtil::cleanUpVectorOfPointers(_physicsConstraints);
+	destroyPlaced(_bones);
+	destroyPlaced(_slots);
+	destroyPlaced(_ikConstraints);
+	destroyPlaced(_transformConstraints);
+	destroyPlaced(_pathConstraints);
+	destroyPlaced(_physicsConstraints);
+	SpineExtension::free(_memory, __FILE__, __LINE__);
 }
 
 void Skeleton::updateCache() {
+	updateSkinKey();
+	UpdateCacheTemplate *updateCacheTemplate = _data->findUpdateCacheTemplate(_skinKey);
+	if (updateCacheTemplate && setUpdateCache(*updateCacheTemplate)) return;
+
 	_updateCache.clear();
 
 	for (size_t i = 0, n = _bones.size(); i < n; ++i) {
@@ -161,56 +222,149 @@ void Skeleton::updateCache() {
 		}
 	}
 
-	size_t ikCount = _ikConstraints.size();
-	size_t transformCount = _transformConstraints.size();
-	size_t pathCount = _pathConstraints.size();
-	size_t physicsCount = _physicsConstraints.size();
-	size_t constraintCount = ikCount + transformCount + pathCount + physicsCount;
-
-	size_t i = 0;
-continue_outer:
-	for (; i < constraintCount; ++i) {
-		for (size_t ii = 0; ii < ikCount; ++ii) {
-			IkConstraint *constraint = _ikConstraints[ii];
-			if (constraint->getData().getOrder() == i) {
-				sortIkConstraint(constraint);
-				i++;
-				goto continue_outer;
-			}
-		}
+	for (size_t i = 0, n = _constraintOrder.size(); i < n; ++i) {
+		Updatable *constraint = _constraintOrder[i];
+		if (!constraint) continue;
+		const RTTI &rtti = constraint->getRTTI();
+		if (rtti.isExactly(IkConstraint::rtti))
+			sortIkConstraint(static_cast<IkConstraint *>(constraint));
+		else if (rtti.isExactly(TransformConstraint::rtti))
+			sortTransformConstraint(static_cast<TransformConstraint *>(constraint));
+		else if (rtti.isExactly(PathConstraint::rtti))
+			sortPathConstraint(static_cast<PathConstraint *>(constraint));
+		else
+			sortPhysicsConstraint(static_cast<PhysicsConstraint *>(constraint));
+	}
 
-		for (size_t ii = 0; ii < transformCount; ++ii) {
-			TransformConstraint *constraint = _transformConstraints[ii];
-			if (constraint->getData().getOrder() == i) {
-				sortTransformConstraint(constraint);
-				i++;
-				goto continue_outer;
-			}
-		}
+	size_t i, n = _bones.size();
+	for (i = 0; i < n; ++i) {
+		sortBone(_bones[i]);
+	}
 
-		for (size_t ii = 0; ii < pathCount; ++ii) {
-			PathConstraint *constraint = _pathConstraints[ii];
-			if (constraint->getData().getOrder() == i) {
-				sortPathConstraint(constraint);
-				i++;
-				goto continue_outer;
-			}
+	// Find the runs of consecutive bones that updateWorldTransform() can update as a batch.
+	size_t cacheCount = _updateCache.size(), longestRun = 0;
+	_boneRunEnds.setSize(cacheCount, 0);
+	for (i = cacheCount; i > 0; --i) {
+		size_t index = i - 1;
+		if (!_updateCache[index]->getRTTI().isExactly(Bone::rtti)) {
+			_boneRunEnds[index] = 0;
+			continue;
 		}
+		int next = index + 1 < cacheCount ? _boneRunEnds[index + 1] : 0;
+		_boneRunEnds[index] = next != 0 ? next : (int) index + 1;
+		longestRun = MathUtil::max(longestRun, _boneRunEnds[index] - index);
+	}
+	_poseBuffer.setSize(longestRun * 4, 0);
 
-		for (size_t ii = 0; ii < physicsCount; ++ii) {
-			PhysicsConstraint *constraint = _physicsConstraints[ii];
-			if (constraint->getData().getOrder() == i) {
-				sortPhysicsConstraint(constraint);
-				i++;
-				goto continue_outer;
-			}
+	if (!updateCacheTemplate) _data->addUpdateCacheTemplate(newUpdateCacheTemplate());
+}
+
+void Skeleton::updateSkinKey() {
+	_skinKey.clear();
+	_skinKey.add(0);
+	if (!_skin) return;
+
+	// Skins are usually small, so the bones and constraints are sorted by insertion.
+	Vector<BoneData *> &skinBones = _skin->_bones;
+	Vector<ConstraintData *> &skinConstraints = _skin->_constraints;
+	_skinKey.ensureCapacity(1 + skinBones.size() + skinConstraints.size());
+	for (size_t i = 0, n = skinBones.size() + skinConstraints.size(); i < n; i++) {
+		int value = i < skinBones.size() ? skinBones[i]->getIndex()
+										 : -1 - (int) skinConstraints[i - skinBones.size()]->getOrder();
+		size_t index = _skinKey.size();
+		while (index > 1 && _skinKey[index - 1] > value) index--;
+		if (index > 1 && _skinKey[index - 1] == value) continue;
+		_skinKey.add(value);
+		int *key = _skinKey.buffer();
+		for (size_t ii = _skinKey.size() - 1; ii > index; ii--)
+			key[ii] = key[ii - 1];
+		key[index] = value;
+	}
+	_skinKey[0] = (int) _skinKey.size() - 1;
+
+	Vector<Vector<Skin::AttachmentMap::Entry>> &buckets = _skin->_attachments._buckets;
+	for (size_t i = 0, n = _pathConstraints.size(); i < n; i++) {
+		size_t slotIndex = _pathConstraints[i]->_target->_data.getIndex();
+		if (slotIndex >= buckets.size()) continue;
+		Vector<Skin::AttachmentMap::Entry> &bucket = buckets[slotIndex];
+		for (size_t ii = 0, nn = bucket.size(); ii < nn; ii++) {
+			Attachment *attachment = bucket[ii]._attachment;
+			if (!attachment->getRTTI().instanceOf(PathAttachment::rtti)) continue;
+			Vector<int> &pathBones = static_cast<PathAttachment *>(attachment)->getBones();
+			_skinKey.add((int) slotIndex);
+			_skinKey.add((int) pathBones.size());
+			_skinKey.addAll(pathBones);
 		}
 	}
+}
 
-	size_t n = _bones.size();
-	for (i = 0; i < n; ++i) {
-		sortBone(_bones[i]);
+bool Skeleton::setUpdateCache(UpdateCacheTemplate &updateCacheTemplate) {
+	for (size_t i = 0, n = _pathConstraints.size(); i < n; ++i)
+		if (_pathConstraints[i]->_target->_attachment != updateCacheTemplate._pathAttachments[i]) return false;
+
+	bool *active = updateCacheTemplate._active.buffer();
+	size_t boneCount = _bones.size();
+	for (size_t i = 0; i < boneCount; ++i)
+		_bones[i]->_active = active[i];
+	for (size_t i = 0, n = _constraintOrder.size(); i < n; ++i) {
+		Updatable *constraint = _constraintOrder[i];
+		if (constraint) constraint->setActive(active[boneCount + i]);
+	}
+
+	int *updatables = updateCacheTemplate._updatables.buffer();
+	size_t count = updateCacheTemplate._updatables.size();
+	_updateCache.setSize(count, NULL);
+	for (size_t i = 0; i < count; ++i) {
+		int index = updatables[i];
+		_updateCache[i] = index >= 0 ? static_cast<Updatable *>(_bones[index]) : _constraintOrder[-1 - index];
+	}
+	_boneRunEnds.clearAndAddAll(updateCacheTemplate._boneRunEnds);
+	_poseBuffer.setSize(updateCacheTemplate._longestRun * 4, 0);
+	return true;
+}
+
+UpdateCacheTemplate *Skeleton::newUpdateCacheTemplate() {
+	// The template belongs to the data, not to an arena that may be current.
+	ArenaScope arenaScope(NULL);
+	UpdateCacheTemplate *updateCacheTemplate = new (__FILE__, __LINE__) UpdateCacheTemplate();
+	updateCacheTemplate->_skinKey.clearAndAddAll(_skinKey);
+
+	size_t boneCount = _bones.size();
+	Vector<bool> &active = updateCacheTemplate->_active;
+	active.ensureCapacity(boneCount + _constraintOrder.size());
+	for (size_t i = 0; i < boneCount; ++i)
+		active.add(_bones[i]->_active);
+	for (size_t i = 0, n = _constraintOrder.size(); i < n; ++i)
+		active.add(_constraintOrder[i] && _constraintOrder[i]->isActive());
+
+	Vector<int> &updatables = updateCacheTemplate->_updatables;
+	updatables.ensureCapacity(_updateCache.size());
+	for (size_t i = 0, n = _updateCache.size(); i < n; ++i) {
+		Updatable *updatable = _updateCache[i];
+		if (updatable->getRTTI().isExactly(Bone::rtti))
+			updatables.add(static_cast<Bone *>(updatable)->_data.getIndex());
+		else {
+			// Constraints are stored by order, which is unique among the constraints updateCache() sorted.
+			size_t order = 0;
+			const RTTI &rtti = updatable->getRTTI();
+			if (rtti.isExactly(IkConstraint::rtti))
+				order = static_cast<IkConstraint *>(updatable)->_data.getOrder();
+			else if (rtti.isExactly(TransformConstraint::rtti))
+				order = static_cast<TransformConstraint *>(updatable)->_data.getOrder();
+			else if (rtti.isExactly(PathConstraint::rtti))
+				order = static_cast<PathConstraint *>(updatable)->_data.getOrder();
+			else
+				order = static_cast<PhysicsConstraint *>(updatable)->_data.getOrder();
+			updatables.add(-1 - (int) order);
+		}
 	}
+
+	updateCacheTemplate->_boneRunEnds.clearAndAddAll(_boneRunEnds);
+	updateCacheTemplate->_longestRun = _poseBuffer.size() / 4;
+	updateCacheTemplate->_pathAttachments.ensureCapacity(_pathConstraints.size());
+	for (size_t i = 0, n = _pathConstraints.size(); i < n; ++i)
+		updateCacheTemplate->_pathAttachments.add(_pathConstraints[i]->_target->_attachment);
+	return updateCacheTemplate;
 }
 
 void Skeleton::printUpdateCache() {
@@ -246,12 +400,141 @@ void Skeleton::updateWorldTransform(Physics physics) {
 		bone->_ashearY = bone->_shearY;
 	}
 
+	if (_usePoseBuffer && _boneRunEnds.size() == _updateCache.size()) {
+		for (size_t i = 0, n = _updateCache.size(); i < n;) {
+			size_t end = (size_t) _boneRunEnds[i];
+			if (end == 0) {
+				_updateCache[i++]->update(physics);
+			} else {
+				updateBoneRun(i, end, physics);
+				i = end;
+			}
+		}
+		return;
+	}
+
 	for (size_t i = 0, n = _updateCache.size(); i < n; ++i) {
 		Updatable *updatable = _updateCache[i];
 		updatable->update(physics);
 	}
 }
 
+#if defined(SPINE_SIMD_SSE) || defined(SPINE_SIMD_NEON)
+// Combines the local matrices of 4 bones with their parents' world transforms, the same as
+// Bone::updateWorldTransform() for Inherit_Normal.
+static void combineBones4(Bone **bones, const float *la, const float *lb, const float *lc, const float *ld,
+						  float *out) {
+	float pa[4], pb[4], pc[4], pd[4], pwx[4], pwy[4], x[4], y[4];
+	for (int i = 0; i < 4; i++) {
+		Bone *parent = bones[i]->getParent();
+		pa[i] = parent->getA();
+		pb[i] = parent->getB();
+		pc[i] = parent->getC();
+		pd[i] = parent->getD();
+		pwx[i] = parent->getWorldX();
+		pwy[i] = parent->getWorldY();
+		x[i] = bones[i]->getAX();
+		y[i] = bones[i]->getAY();
+	}
+#ifdef SPINE_SIMD_SSE
+	__m128 vpa = _mm_loadu_ps(pa), vpb = _mm_loadu_ps(pb), vpc = _mm_loadu_ps(pc), vpd = _mm_loadu_ps(pd);
+	__m128 vx = _mm_loadu_ps(x), vy = _mm_loadu_ps(y);
+	__m128 vla = _mm_loadu_ps(la), vlb = _mm_loadu_ps(lb), vlc = _mm_loadu_ps(lc), vld = _mm_loadu_ps(ld);
+	_mm_storeu_ps(out, _mm_add_ps(_mm_mul_ps(vpa, vla), _mm_mul_ps(vpb, vlc)));
+	_mm_storeu_ps(out + 4, _mm_add_ps(_mm_mul_ps(vpa, vlb), _mm_mul_ps(vpb, vld)));
+	_mm_storeu_ps(out + 8, _mm_add_ps(_mm_mul_ps(vpc, vla), _mm_mul_ps(vpd, vlc)));
+	_mm_storeu_ps(out + 12, _mm_add_ps(_mm_mul_ps(vpc, vlb), _mm_mul_ps(vpd, vld)));
+	_mm_storeu_ps(out + 16, _mm_add_ps(_mm_add_ps(_mm_mul_ps(vpa, vx), _mm_mul_ps(vpb, vy)), _mm_loadu_ps(pwx)));
+	_mm_storeu_ps(out + 20, _mm_add_ps(_mm_add_ps(_mm_mul_ps(vpc, vx), _mm_mul_ps(vpd, vy)), _mm_loadu_ps(pwy)));
+#else
+	float32x4_t vpa = vld1q_f32(pa), vpb = vld1q_f32(pb), vpc = vld1q_f32(pc), vpd = vld1q_f32(pd);
+	float32x4_t vx = vld1q_f32(x), vy = vld1q_f32(y);
+	float32x4_t vla = vld1q_f32(la), vlb = vld1q_f32(lb), vlc = vld1q_f32(lc), vld = vld1q_f32(ld);
+	vst1q_f32(out, vaddq_f32(vmulq_f32(vpa, vla), vmulq_f32(vpb, vlc)));
+	vst1q_f32(out + 4, vaddq_f32(vmulq_f32(vpa, vlb), vmulq_f32(vpb, vld)));
+	vst1q_f32(out + 8, vaddq_f32(vmulq_f32(vpc, vla), vmulq_f32(vpd, vlc)));
+	vst1q_f32(out + 12, vaddq_f32(vmulq_f32(vpc, vlb), vmulq_f32(vpd, vld)));
+	vst1q_f32(out + 16, vaddq_f32(vaddq_f32(vmulq_f32(vpa, vx), vmulq_f32(vpb, vy)), vld1q_f32(pwx)));
+	vst1q_f32(out + 20, vaddq_f32(vaddq_f32(vmulq_f32(vpc, vx), vmulq_f32(vpd, vy)), vld1q_f32(pwy)));
+#endif
+}
+#endif
+
+void Skeleton::updateBoneRun(size_t start, size_t end, Physics physics) {
+	Updatable **cache = _updateCache.buffer() + start;
+	size_t count = end - start;
+	float *la = _poseBuffer.buffer(), *lb = la + count, *lc = lb + count, *ld = lc + count;
+
+	// The local matrices only depend on each bone's own applied transform. The angles are stored in la and lb, then
+	// replaced by their cosines, with the sines in lc and ld.
+	for (size_t i = 0; i < count; i++) {
+		Bone *bone = static_cast<Bone *>(cache[i]);
+		la[i] = (bone->_arotation + bone->_ashearX) * MathUtil::Deg_Rad;
+		lb[i] = (bone->_arotation + 90 + bone->_ashearY) * MathUtil::Deg_Rad;
+	}
+	MathUtil::sinCos(la, lc, la, count);
+	MathUtil::sinCos(lb, ld, lb, count);
+	for (size_t i = 0; i < count; i++) {
+		Bone *bone = static_cast<Bone *>(cache[i]);
+		la[i] *= bone->_ascaleX;
+		lb[i] *= bone->_ascaleY;
+		lc[i] *= bone->_ascaleX;
+		ld[i] *= bone->_ascaleY;
+	}
+
+	// Combining with the parent must happen in update cache order, as a parent may be part of the run.
+	for (size_t i = 0; i < count;) {
+#if defined(SPINE_SIMD_SSE) || defined(SPINE_SIMD_NEON)
+		if (i + 4 <= count) {
+			Bone *group[4];
+			bool batch = true;
+			for (size_t ii = 0; ii < 4 && batch; ii++) {
+				Bone *bone = group[ii] = static_cast<Bone *>(cache[i + ii]);
+				if (bone->_inherit != Inherit_Normal || !bone->_parent) batch = false;
+				for (size_t iii = 0; iii < ii && batch; iii++)
+					if (bone->_parent == group[iii]) batch = false;
+			}
+			if (batch) {
+				float out[24];
+				combineBones4(group, la + i, lb + i, lc + i, ld + i, out);
+				for (size_t ii = 0; ii < 4; ii++) {
+					Bone *bone = group[ii];
+					bone->_a = out[ii];
+					bone->_b = out[4 + ii];
+					bone->_c = out[8 + ii];
+					bone->_d = out[12 + ii];
+					bone->_worldX = out[16 + ii];
+					bone->_worldY = out[20 + ii];
+				}
+				i += 4;
+				continue;
+			}
+		}
+#endif
+		Bone *bone = static_cast<Bone *>(cache[i]);
+		Bone *parent = bone->_parent;
+		if (bone->_inherit == Inherit_Normal && parent) {
+			float pa = parent->_a, pb = parent->_b, pc = parent->_c, pd = parent->_d;
+			bone->_worldX = pa * bone->_ax + pb * bone->_ay + parent->_worldX;
+			bone->_worldY = pc * bone->_ax + pd * bone->_ay + parent->_worldY;
+			bone->_a = pa * la[i] + pb * lc[i];
+			bone->_b = pa * lb[i] + pb * ld[i];
+			bone->_c = pc * la[i] + pd * lc[i];
+			bone->_d = pc * lb[i] + pd * ld[i];
+		} else
+			bone->update(physics);
+		i++;
+	}
+}
+
+void Skeleton::setUsePoseBuffer(bool usePoseBuffer) {
+	_usePoseBuffer = usePoseBuffer;
+}
+
+bool Skeleton::getUsePoseBuffer() {
+	return _usePoseBuffer;
+}
+
 void Skeleton::updateWorldTransform(Physics physics, Bone *parent) {
 	// Apply the parent bone transform to the root bone. The root bone always
 	// inherits scale, rotation and reflection.
@@ -262,10 +545,13 @@ void Skeleton::updateWorldTransform(Physics physics, Bone *parent) {
 
 	float rx = (rootBone->_rotation + rootBone->_shearX) * MathUtil::Deg_Rad;
 	float ry = (rootBone->_rotation + 90 + rootBone->_shearY) * MathUtil::Deg_Rad;
-	float la = MathUtil::cos(rx) * rootBone->_scaleX;
-	float lb = MathUtil::cos(ry) * rootBone->_scaleY;
-	float lc = MathUtil::sin(rx) * rootBone->_scaleX;
-	float ld = MathUtil::sin(ry) * rootBone->_scaleY;
+	float sinX, cosX, sinY, cosY;
+	MathUtil::sinCos(rx, sinX, cosX);
+	MathUtil::sinCos(ry, sinY, cosY);
+	float la = cosX * rootBone->_scaleX;
+	float lb = cosY * rootBone->_scaleY;
+	float lc = sinX * rootBone->_scaleX;
+	float ld = sinY * rootBone->_scaleY;
 	rootBone->_a = (pa * la + pb * lc) * _scaleX;
 	rootBone->_b = (pa * lb + pb * ld) * _scaleX;
 	rootBone->_c = (pc * la + pd * lc) * _scaleY;
@@ -285,6 +571,38 @@ void Skeleton::setToSetupPose() {
 	setSlotsToSetupPose();
 }
 
+void Skeleton::reset() {
+	_skin = NULL;
+	_usePoseBuffer = false;
+	_color.set(1, 1, 1, 1);
+	_scaleX = 1;
+	_scaleY = 1;
+	_x = 0;
+	_y = 0;
+	_time = 0;
+	for (size_t i = 0, n = _bones.size(); i < n; ++i) {
+		// Bones that stay inactive are not updated, so clear what the previous use left behind.
+		Bone *bone = _bones[i];
+		bone->_ax = bone->_ay = bone->_arotation = bone->_ascaleX = bone->_ascaleY = bone->_ashearX = bone->_ashearY = 0;
+		bone->_a = bone->_d = 1;
+		bone->_b = bone->_c = 0;
+		bone->_worldX = bone->_worldY = 0;
+	}
+	for (size_t i = 0, n = _slots.size(); i < n; ++i) {
+		// Match the state of a newly constructed slot, which AnimationState relies on.
+		Slot *slot = _slots[i];
+		slot->_attachment = NULL;
+		slot->_attachmentState = 0;
+		slot->_sequenceIndex = 0;
+		slot->_deform.clear();
+	}
+	setToSetupPose();
+	for (size_t i = 0, n = _physicsConstraints.size(); i < n; ++i) {
+		_physicsConstraints[i]->reset();
+	}
+	updateCache();
+}
+
 void Skeleton::setBonesToSetupPose() {
 	for (size_t i = 0, n = _bones.size(); i < n; ++i) {
 		_bones[i]->setToSetupPose();
@@ -318,12 +636,21 @@ void Skeleton::setSlotsToSetupPose() {
 	}
 }
 
+// Items of a skeleton are created in the same order as their data, so the data's name index can be used to find them.
+template<typename T, typename D>
+static T *findWithDataIndex(Vector<T *> &items, Vector<D *> &datas, NameIndex &index, const String &name) {
+	int i = index.find(datas, name);
+	if (i == -1) return NULL;
+	if (i < (int) items.size() && &items[i]->getData() == datas[i]) return items[i];
+	return ContainerUtil::findWithDataName(items, name);
+}
+
 Bone *Skeleton::findBone(const String &boneName) {
-	return ContainerUtil::findWithDataName(_bones, boneName);
+	return findWithDataIndex(_bones, _data->_bones, _data->_boneIndex, boneName);
 }
 
 Slot *Skeleton::findSlot(const String &slotName) {
-	return ContainerUtil::findWithDataName(_slots, slotName);
+	return findWithDataIndex(_slots, _data->_slots, _data->_slotIndex, slotName);
 }
 
 void Skeleton::setSkin(const String &skinName) {
@@ -379,24 +706,61 @@ Attachment *Skeleton::getAttachment(int slotIndex,
 				   : NULL;
 }
 
+Attachment *Skeleton::getAttachmentById(int slotIndex, int attachmentId) {
+	if (_attachmentCacheSkin != _skin || _attachmentCacheDefaultSkin != _data->_defaultSkin ||
+		_attachmentCacheVersion != getAttachmentCacheVersion() || _attachmentCacheOffsets.size() == 0)
+		updateAttachmentCache();
+	assert(attachmentId >= 0 && _attachmentCacheOffsets[slotIndex] + attachmentId < _attachmentCacheOffsets[slotIndex + 1]);
+	return _attachmentCache[_attachmentCacheOffsets[slotIndex] + attachmentId];
+}
+
+size_t Skeleton::getAttachmentCacheVersion() {
+	// The versions only increase, so the sum changes whenever one of them does.
+	size_t version = _data->_attachmentIdsVersion;
+	if (_skin) version += _skin->_version;
+	if (_data->_defaultSkin) version += _data->_defaultSkin->_version;
+	return version;
+}
+
+void Skeleton::updateAttachmentCache() {
+	_attachmentCacheSkin = _skin;
+	_attachmentCacheDefaultSkin = _data->_defaultSkin;
+	_attachmentCacheVersion = getAttachmentCacheVersion();
+
+	size_t n = _slots.size();
+	_attachmentCacheOffsets.setSize(n + 1, 0);
+	size_t count = 0;
+	for (size_t i = 0; i < n; ++i) {
+		_attachmentCacheOffsets[i] = count;
+		count += _slots[i]->_data._attachmentKeys.size();
+	}
+	_attachmentCacheOffsets[n] = count;
+
+	_attachmentCache.setSize(count, NULL);
+	for (size_t i = 0; i < n; ++i) {
+		Vector<String> &keys = _slots[i]->_data._attachmentKeys;
+		Attachment **attachments = _attachmentCache.buffer() + _attachmentCacheOffsets[i];
+		for (size_t ii = 0; ii < keys.size(); ++ii)
+			attachments[ii] = getAttachment((int) i, keys[ii]);
+	}
+}
+
 void Skeleton::setAttachment(const String &slotName,
 							 const String &attachmentName) {
 	assert(slotName.length() > 0);
 
-	for (size_t i = 0, n = _slots.size(); i < n; ++i) {
-		Slot *slot = _slots[i];
-		if (slot->_data.getName() == slotName) {
-			Attachment *attachment = NULL;
-			if (attachmentName.length() > 0) {
-				attachment = getAttachment((int) i, attachmentName);
+	Slot *slot = findSlot(slotName);
+	if (slot) {
+		Attachment *attachment = NULL;
+		if (attachmentName.length() > 0) {
+			attachment = getAttachment(slot->_data.getIndex(), attachmentName);
 
-				assert(attachment != NULL);
-			}
+			assert(attachment != NULL);
+		}
 
-			slot->setAttachment(attachment);
+		slot->setAttachment(attachment);
 
-			return;
-		}
+		return;
 	}
 
 	printf("Slot not found: %s", slotName.buffer());
@@ -405,56 +769,21 @@ void Skeleton::setAttachment(const String &slotName,
 }
 
 IkConstraint *Skeleton::findIkConstraint(const String &constraintName) {
-	assert(constraintName.length() > 0);
-
-	for (size_t i = 0, n = _ikConstraints.size(); i < n; ++i) {
-		IkConstraint *ikConstraint = _ikConstraints[i];
-		if (ikConstraint->_data.getName() == constraintName) {
-			return ikConstraint;
-		}
-	}
-	return NULL;
+	return findWithDataIndex(_ikConstraints, _data->_ikConstraints, _data->_ikConstraintIndex, constraintName);
 }
 
 TransformConstraint *
 Skeleton::findTransformConstraint(const String &constraintName) {
-	assert(constraintName.length() > 0);
-
-	for (size_t i = 0, n = _transformConstraints.size(); i < n; ++i) {
-		TransformConstraint *transformConstraint = _transformConstraints[i];
-		if (transformConstraint->_data.getName() == constraintName) {
-			return transformConstraint;
-		}
-	}
-
-	return NULL;
+	return findWithDataIndex(_transformConstraints, _data->_transformConstraints, _data->_transformConstraintIndex, constraintName);
 }
 
 PathConstraint *Skeleton::findPathConstraint(const String &constraintName) {
-	assert(constraintName.length() > 0);
-
-	for (size_t i = 0, n = _pathConstraints.size(); i < n; ++i) {
-		PathConstraint *constraint = _pathConstraints[i];
-		if (constraint->_data.getName() == constraintName) {
-			return constraint;
-		}
-	}
-
-	return NULL;
+	return findWithDataIndex(_pathConstraints, _data->_pathConstraints, _data->_pathConstraintIndex, constraintName);
 }
 
 PhysicsConstraint *
 Skeleton::findPhysicsConstraint(const String &constraintName) {
-	assert(constraintName.length() > 0);
-
-	for (size_t i = 0, n = _physicsConstraints.size(); i < n; ++i) {
-		PhysicsConstraint *constraint = _physicsConstraints[i];
-		if (constraint->_data.getName() == constraintName) {
-			return constraint;
-		}
-	}
-
-	return NULL;
+	return findWithDataIndex(_physicsConstraints, _data->_physicsConstraints, _data->_physicsConstraintIndex, constraintName);
 }
 
 void Skeleton::getBounds(float &outX, float &outY, float &outWidth,
@@ -537,6 +866,72 @@ void Skeleton::getBounds(float &outX, float &outY, float &outWidth,
 	outHeight = maxY - minY;
 }
 
+// Expands the AABB by a local AABB transformed by the bone's world transform.
+static inline void addBounds(Bone &bone, const float *bounds, float &minX, float &minY, float &maxX, float &maxY) {
+	float a = bone.getA(), b = bone.getB(), c = bone.getC(), d = bone.getD();
+	float cx = (bounds[0] + bounds[2]) * 0.5f, cy = (bounds[1] + bounds[3]) * 0.5f;
+	float hx = (bounds[2] - bounds[0]) * 0.5f, hy = (bounds[3] - bounds[1]) * 0.5f;
+	float x = cx * a + cy * b + bone.getWorldX(), y = cx * c + cy * d + bone.getWorldY();
+	float ex = MathUtil::abs(a) * hx + MathUtil::abs(b) * hy, ey = MathUtil::abs(c) * hx + MathUtil::abs(d) * hy;
+	minX = MathUtil::min(minX, x - ex);
+	minY = MathUtil::min(minY, y - ey);
+	maxX = MathUtil::max(maxX, x + ex);
+	maxY = MathUtil::max(maxY, y + ey);
+}
+
+static inline void addVertices(const float *vertices, size_t count, float &minX, float &minY, float &maxX, float &maxY) {
+	for (size_t i = 0; i < count; i += 2) {
+		minX = MathUtil::min(minX, vertices[i]);
+		minY = MathUtil::min(minY, vertices[i + 1]);
+		maxX = MathUtil::max(maxX, vertices[i]);
+		maxY = MathUtil::max(maxY, vertices[i + 1]);
+	}
+}
+
+void Skeleton::getConservativeBounds(float &outX, float &outY, float &outWidth, float &outHeight) {
+	float minX = FLT_MAX;
+	float minY = FLT_MAX;
+	float maxX = -FLT_MAX;
+	float maxY = -FLT_MAX;
+
+	// Vertices of meshes without local bounds are computed in chunks of this size.
+	float vertices[256];
+	for (size_t i = 0, n = _slots.size(); i < n; ++i) {
+		Slot *slot = _slots[i];
+		if (!slot->_bone._active) continue;
+		Attachment *attachment = slot->getAttachment();
+		if (attachment == NULL) continue;
+
+		if (attachment->getRTTI().instanceOf(RegionAttachment::rtti)) {
+			static_cast<RegionAttachment *>(attachment)->computeWorldVertices(*slot, vertices, 0);
+			addVertices(vertices, 8, minX, minY, maxX, maxY);
+		} else if (attachment->getRTTI().instanceOf(MeshAttachment::rtti)) {
+			MeshAttachment *mesh = static_cast<MeshAttachment *>(attachment);
+			Vector<float> &bounds = mesh->getBounds();
+			if (bounds.size() > 0 && slot->getDeform().size() == 0) {
+				Vector<int> &bones = mesh->getBoundsBones();
+				if (bones.size() == 0)
+					addBounds(slot->_bone, bounds.buffer(), minX, minY, maxX, maxY);
+				else {
+					for (size_t ii = 0, nn = bones.size(); ii < nn; ii++)
+						addBounds(*_bones[bones[ii]], bounds.buffer() + ii * 4, minX, minY, maxX, maxY);
+				}
+			} else {
+				for (size_t start = 0, length = mesh->getWorldVerticesLength(); start < length; start += 256) {
+					size_t count = MathUtil::min(length - start, (size_t) 256);
+					mesh->computeWorldVertices(*slot, start, count, vertices, 0);
+					addVertices(vertices, count, minX, minY, maxX, maxY);
+				}
+			}
+		}
+	}
+
+	outX = minX;
+	outY = minY;
+	outWidth = maxX - minX;
+	outHeight = maxY - minY;
+}
+
 Bone *Skeleton::getRootBone() { return _bones.size() == 0 ? NULL : _bones[0]; }
 
 SkeletonData *Skeleton::getData() { return _data; }
@@ -703,15 +1098,11 @@ void Skeleton::sortPhysicsConstraint(PhysicsConstraint *constraint) {
 
 void Skeleton::sortPathConstraintAttachment(Skin *skin, size_t slotIndex,
 											Bone &slotBone) {
-	Skin::AttachmentMap::Entries attachments = skin->getAttachments();
-
-	while (attachments.hasNext()) {
-		Skin::AttachmentMap::Entry entry = attachments.next();
-		if (entry._slotIndex == slotIndex) {
-			Attachment *value = entry._attachment;
-			sortPathConstraintAttachment(value, slotBone);
-		}
-	}
+	Vector<Vector<Skin::AttachmentMap::Entry>> &buckets = skin->_attachments._buckets;
+	if (slotIndex >= buckets.size()) return;
+	Vector<Skin::AttachmentMap::Entry> &bucket = buckets[slotIndex];
+	for (size_t i = 0, n = bucket.size(); i < n; i++)
+		sortPathConstraintAttachment(bucket[i]._attachment, slotBone);
 }
 
 void Skeleton::sortPathConstraintAttachment(Attachment *attachment,
@@ -0,0 +1,162 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/SkeletonBatchUpdater.h>
+
+#include <spine/AnimationState.h>
+#include <spine/MeshAttachment.h>
+#include <spine/RegionAttachment.h>
+#include <spine/Skeleton.h>
+#include <spine/SkeletonData.h>
+#include <spine/SkeletonRenderer.h>
+#include <spine/Skin.h>
+#include <spine/TaskRunner.h>
+
+using namespace spine;
+
+SkeletonBatchUpdater::SkeletonBatchUpdater(TaskRunner *taskRunner, bool ownsTaskRunner) : _taskRunner(taskRunner),
+																						 _ownsTaskRunner(ownsTaskRunner),
+																						 _render(false),
+																						 _batchSize(16),
+																						 _physics(Physics_None) {
+}
+
+SkeletonBatchUpdater::~SkeletonBatchUpdater() {
+	clear();
+	if (_ownsTaskRunner) delete _taskRunner;
+}
+
+size_t SkeletonBatchUpdater::add(AnimationState *state, Skeleton *skeleton, float delta, SkeletonRenderer *renderer) {
+	assert(skeleton != NULL);
+	Instance instance;
+	instance.state = state;
+	instance.skeleton = skeleton;
+	instance.delta = delta;
+	instance.renderer = renderer;
+	instance.renderCommands = NULL;
+	instance.ownsRenderer = false;
+	instance.serialRender = hasSequences(skeleton->getData());
+	_instances.add(instance);
+	return _instances.size() - 1;
+}
+
+void SkeletonBatchUpdater::setDelta(size_t index, float delta) {
+	_instances[index].delta = delta;
+}
+
+void SkeletonBatchUpdater::clear() {
+	for (size_t i = 0; i < _instances.size(); i++) {
+		if (_instances[i].ownsRenderer) delete _instances[i].renderer;
+	}
+	_instances.clear();
+}
+
+size_t SkeletonBatchUpdater::size() {
+	return _instances.size();
+}
+
+void SkeletonBatchUpdater::setRender(bool render) {
+	_render = render;
+}
+
+bool SkeletonBatchUpdater::getRender() {
+	return _render;
+}
+
+void SkeletonBatchUpdater::setBatchSize(size_t batchSize) {
+	_batchSize = batchSize > 0 ? batchSize : 1;
+}
+
+void SkeletonBatchUpdater::update(Physics physics) {
+	_physics = physics;
+	if (_render) {
+		// Renderers are created up front, the updater's allocations must not happen on the worker threads.
+		for (size_t i = 0; i < _instances.size(); i++) {
+			Instance &instance = _instances[i];
+			if (!instance.renderer) {
+				instance.renderer = new (__FILE__, __LINE__) SkeletonRenderer();
+				instance.ownsRenderer = true;
+			}
+		}
+	}
+
+	size_t batches = (_instances.size() + _batchSize - 1) / _batchSize;
+	if (_taskRunner)
+		_taskRunner->run(batches, updateBatch, this);
+	else {
+		for (size_t i = 0; i < batches; i++)
+			updateBatch(this, i);
+	}
+
+	if (_render) {
+		for (size_t i = 0; i < _instances.size(); i++) {
+			Instance &instance = _instances[i];
+			if (instance.serialRender) instance.renderCommands = instance.renderer->render(*instance.skeleton);
+		}
+	}
+}
+
+RenderCommand *SkeletonBatchUpdater::getRenderCommands(size_t index) {
+	return _render ? _instances[index].renderCommands : NULL;
+}
+
+void SkeletonBatchUpdater::updateBatch(void *context, size_t index) {
+	SkeletonBatchUpdater *updater = (SkeletonBatchUpdater *) context;
+	size_t start = index * updater->_batchSize;
+	size_t end = MathUtil::min(start + updater->_batchSize, updater->_instances.size());
+	for (size_t i = start; i < end; i++)
+		updater->updateInstance(updater->_instances[i], updater->_render);
+}
+
+void SkeletonBatchUpdater::updateInstance(Instance &instance, bool render) {
+	Skeleton &skeleton = *instance.skeleton;
+	if (instance.state) {
+		instance.state->update(instance.delta);
+		instance.state->apply(skeleton);
+	}
+	skeleton.update(instance.delta);
+	skeleton.updateWorldTransform(_physics);
+	if (render && !instance.serialRender) instance.renderCommands = instance.renderer->render(skeleton);
+}
+
+bool SkeletonBatchUpdater::hasSequences(SkeletonData *data) {
+	Vector<Skin *> &skins = data->getSkins();
+	for (size_t i = 0; i < skins.size(); i++) {
+		Skin::AttachmentMap::Entries entries = skins[i]->getAttachments();
+		while (entries.hasNext()) {
+			Attachment *attachment = entries.next()._attachment;
+			if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+				if (static_cast<RegionAttachment *>(attachment)->getSequence()) return true;
+			} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+				if (static_cast<MeshAttachment *>(attachment)->getSequence()) return true;
+			}
+		}
+	}
+	return false;
+}
@@ -72,23 +72,58 @@
 #include <spine/TransformConstraintTimeline.h>
 #include <spine/TranslateTimeline.h>
 #include <spine/SequenceTimeline.h>
+#include <spine/StringTable.h>
+#include <spine/TaskRunner.h>
 #include <spine/Version.h>
 
 using namespace spine;
 
+struct SkeletonBinary::AnimationTask {
+	SkeletonBinary *loader;
+	SkeletonData *skeletonData;
+	DataInput input;
+	String name;
+	Arena *arena;
+	Animation *animation;
+	String error;
+
+	AnimationTask() : loader(NULL), skeletonData(NULL), arena(NULL), animation(NULL) {
+		input.cursor = NULL;
+		input.end = NULL;
+	}
+};
+
 SkeletonBinary::SkeletonBinary(Atlas *atlasArray) : _attachmentLoader(
 															new (__FILE__, __LINE__) AtlasAttachmentLoader(atlasArray)),
-													_error(), _scale(1), _ownsLoader(true) {
+													_error(), _scale(1), _bezierSamples(0), _useArena(false),
+													_taskRunner(NULL), _lazyAnimations(false), _ownsLoader(true),
+													_atlasLoader(true) {
 }
 
 SkeletonBinary::SkeletonBinary(AttachmentLoader *attachmentLoader, bool ownsLoader) : _attachmentLoader(
 																							  attachmentLoader),
 																					  _error(),
 																					  _scale(1),
-																					  _ownsLoader(ownsLoader) {
+																					  _bezierSamples(0),
+																					  _useArena(false),
+																					  _taskRunner(NULL),
+																					  _lazyAnimations(false),
+																					  _ownsLoader(ownsLoader),
+																					  _atlasLoader(false) {
 	assert(_attachmentLoader != NULL);
 }
 
+SkeletonBinary::SkeletonBinary(float scale, size_t bezierSamples) : _attachmentLoader(NULL),
+																	_error(),
+																	_scale(scale),
+																	_bezierSamples(bezierSamples),
+																	_useArena(false),
+																	_taskRunner(NULL),
+																	_lazyAnimations(false),
+																	_ownsLoader(false),
+																	_atlasLoader(false) {
+}
+
 SkeletonBinary::~SkeletonBinary() {
 	ContainerUtil::cleanUpVectorOfPointers(_linkedMeshes);
 	_linkedMeshes.clear();
@@ -97,6 +132,15 @@ SkeletonBinary::~SkeletonBinary() {
 }
 
 SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, const int length) {
+	// Everything allocated while loading goes into the arena. It is handed to the skeleton data if loading succeeds,
+	// otherwise the scope deletes it after the partially loaded data was deleted.
+	ArenaScope arenaScope(_useArena ? new (__FILE__, __LINE__) Arena() : NULL, true);
+	SkeletonData *skeletonData = parseSkeletonData(binary, length);
+	if (skeletonData) skeletonData->_arena = arenaScope.release();
+	return skeletonData;
+}
+
+SkeletonData *SkeletonBinary::parseSkeletonData(const unsigned char *binary, const int length) {
 	bool nonessential;
 	SkeletonData *skeletonData;
 
@@ -106,7 +150,11 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 
 	_linkedMeshes.clear();
 
-	skeletonData = new (__FILE__, __LINE__) SkeletonData();
+	{
+		// The skeleton data owns the arena, so it is not allocated from it.
+		ArenaScope arenaScope(NULL);
+		skeletonData = new (__FILE__, __LINE__) SkeletonData();
+	}
 
 	char buffer[16] = {0};
 	int lowHash = readInt(input);
@@ -145,16 +193,18 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	}
 
 	int numStrings = readVarint(input, true);
+	skeletonData->_strings.ensureCapacity(numStrings + 1);
+	skeletonData->_strings.add(String());
 	for (int i = 0; i < numStrings; i++)
-		skeletonData->_strings.add(readString(input));
+		skeletonData->_strings.add(readInternedString(input));
 
 	/* Bones. */
 	int numBones = readVarint(input, true);
 	skeletonData->_bones.setSize(numBones, 0);
 	for (int i = 0; i < numBones; ++i) {
-		const char *name = readString(input);
+		String name = readInternedString(input);
 		BoneData *parent = i == 0 ? 0 : skeletonData->_bones[readVarint(input, true)];
-		BoneData *data = new (__FILE__, __LINE__) BoneData(i, String(name, true), parent);
+		BoneData *data = new (__FILE__, __LINE__) BoneData(i, name, parent);
 		data->_rotation = readFloat(input);
 		data->_x = readFloat(input) * _scale;
 		data->_y = readFloat(input) * _scale;
@@ -177,7 +227,7 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	int slotsCount = readVarint(input, true);
 	skeletonData->_slots.setSize(slotsCount, 0);
 	for (int i = 0; i < slotsCount; ++i) {
-		String slotName = String(readString(input), true);
+		String slotName = readInternedString(input);
 		BoneData *boneData = skeletonData->_bones[readVarint(input, true)];
 		SlotData *slotData = new (__FILE__, __LINE__) SlotData(i, slotName, *boneData);
 
@@ -202,8 +252,8 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	int ikConstraintsCount = readVarint(input, true);
 	skeletonData->_ikConstraints.setSize(ikConstraintsCount, 0);
 	for (int i = 0; i < ikConstraintsCount; ++i) {
-		const char *name = readString(input);
-		IkConstraintData *data = new (__FILE__, __LINE__) IkConstraintData(String(name, true));
+		String name = readInternedString(input);
+		IkConstraintData *data = new (__FILE__, __LINE__) IkConstraintData(name);
 		data->setOrder(readVarint(input, true));
 		int bonesCount = readVarint(input, true);
 		data->_bones.setSize(bonesCount, 0);
@@ -226,8 +276,8 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	int transformConstraintsCount = readVarint(input, true);
 	skeletonData->_transformConstraints.setSize(transformConstraintsCount, 0);
 	for (int i = 0; i < transformConstraintsCount; ++i) {
-		const char *name = readString(input);
-		TransformConstraintData *data = new (__FILE__, __LINE__) TransformConstraintData(String(name, true));
+		String name = readInternedString(input);
+		TransformConstraintData *data = new (__FILE__, __LINE__) TransformConstraintData(name);
 		data->setOrder(readVarint(input, true));
 		int bonesCount = readVarint(input, true);
 		data->_bones.setSize(bonesCount, 0);
@@ -259,8 +309,8 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	int pathConstraintsCount = readVarint(input, true);
 	skeletonData->_pathConstraints.setSize(pathConstraintsCount, 0);
 	for (int i = 0; i < pathConstraintsCount; ++i) {
-		const char *name = readString(input);
-		PathConstraintData *data = new (__FILE__, __LINE__) PathConstraintData(String(name, true));
+		String name = readInternedString(input);
+		PathConstraintData *data = new (__FILE__, __LINE__) PathConstraintData(name);
 		data->setOrder(readVarint(input, true));
 		data->setSkinRequired(readBoolean(input));
 		int bonesCount = readVarint(input, true);
@@ -288,8 +338,8 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	int physicsConstraintsCount = readVarint(input, true);
 	skeletonData->_physicsConstraints.setSize(physicsConstraintsCount, 0);
 	for (int i = 0; i < physicsConstraintsCount; i++) {
-		const char *name = readString(input);
-		PhysicsConstraintData *data = new (__FILE__, __LINE__) PhysicsConstraintData(String(name, true));
+		String name = readInternedString(input);
+		PhysicsConstraintData *data = new (__FILE__, __LINE__) PhysicsConstraintData(name);
 		data->_order = readVarint(input, true);
 		data->_bone = skeletonData->_bones[readVarint(input, true)];
 		int flags = readByte(input);
@@ -359,6 +409,8 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 																			  : linkedMesh->_mesh;
 		linkedMesh->_mesh->setParentMesh(static_cast<MeshAttachment *>(parent));
 		if (linkedMesh->_mesh->_region) linkedMesh->_mesh->updateRegion();
+		ArenaScope loaderScope;
+		if (!_atlasLoader) loaderScope.enter(NULL);
 		_attachmentLoader->configureAttachment(linkedMesh->_mesh);
 	}
 	ContainerUtil::cleanUpVectorOfPointers(_linkedMeshes);
@@ -368,11 +420,11 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	int eventsCount = readVarint(input, true);
 	skeletonData->_events.setSize(eventsCount, 0);
 	for (int i = 0; i < eventsCount; ++i) {
-		const char *name = readString(input);
-		EventData *eventData = new (__FILE__, __LINE__) EventData(String(name, true));
+		String name = readInternedString(input);
+		EventData *eventData = new (__FILE__, __LINE__) EventData(name);
 		eventData->_intValue = readVarint(input, false);
 		eventData->_floatValue = readFloat(input);
-		eventData->_stringValue.own(readString(input));
+		eventData->_stringValue = readInternedString(input);
 		eventData->_audioPath.own(readString(input));
 		if (!eventData->_audioPath.isEmpty()) {
 			eventData->_volume = readFloat(input);
@@ -381,11 +433,25 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 		skeletonData->_events[i] = eventData;
 	}
 
+	skeletonData->updateNameIndex();
+
 	/* Animations. */
 	int animationsCount = readVarint(input, true);
 	skeletonData->_animations.setSize(animationsCount, 0);
-	for (int i = 0; i < animationsCount; ++i) {
-		String name(readString(input), true);
+	int animationsRead = 0;
+	Vector<int> attachmentKeys;
+	if (_lazyAnimations) {
+		animationsRead = readLazyAnimations(input, skeletonData, animationsCount, attachmentKeys);
+	} else if (_taskRunner) {
+		animationsRead = readAnimations(input, skeletonData, animationsCount);
+		if (animationsRead == -1) {
+			delete input;
+			delete skeletonData;
+			return NULL;
+		}
+	}
+	for (int i = animationsRead; i < animationsCount; ++i) {
+		String name = readInternedString(input);
 		Animation *animation = readAnimation(name, input, skeletonData);
 		if (!animation) {
 			delete input;
@@ -396,23 +462,39 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	}
 
 	delete input;
+	skeletonData->updateNameIndex();
+	skeletonData->updateAttachmentIds();
+	// Lazily read animations have no timelines yet, so their keys are interned from the slot and string indices found
+	// when skipping over them.
+	for (size_t i = 0; i < attachmentKeys.size(); i += 2) {
+		if (attachmentKeys[i] >= (int) skeletonData->_slots.size()) continue;
+		const String &name = skeletonData->_strings[attachmentKeys[i + 1]];
+		SkeletonData::internAttachmentName(*skeletonData->_slots[attachmentKeys[i]], name);
+	}
 	return skeletonData;
 }
 
 SkeletonData *SkeletonBinary::readSkeletonDataFile(const String &path) {
-	int length;
+	int length = 0;
 	SkeletonData *skeletonData;
-	const char *binary = SpineExtension::readFile(path.buffer(), &length);
+	// The file is only needed while loading, mapping it avoids copying it to the heap first.
+	const char *binary = SpineExtension::mapFile(path.buffer(), &length);
+	bool mapped = binary != NULL;
+	if (!mapped) binary = SpineExtension::readFile(path.buffer(), &length);
 	if (length == 0 || !binary) {
 		setError("Unable to read skeleton file: ", path.buffer());
 		return NULL;
 	}
 	skeletonData = readSkeletonData((unsigned char *) binary, length);
-	SpineExtension::free(binary, __FILE__, __LINE__);
+	if (mapped)
+		SpineExtension::unmapFile(binary, length);
+	else
+		SpineExtension::free(binary, __FILE__, __LINE__);
 	return skeletonData;
 }
 
 void SkeletonBinary::setError(const char *value1, const char *value2) {
+	ArenaScope arenaScope(NULL);
 	char message[256];
 	int length;
 	strcpy(message, value1);
@@ -432,9 +514,17 @@ char *SkeletonBinary::readString(DataInput *input) {
 	return string;
 }
 
-char *SkeletonBinary::readStringRef(DataInput *input, SkeletonData *skeletonData) {
+String SkeletonBinary::readInternedString(DataInput *input) {
+	int length = readVarint(input, true);
+	if (length == 0) return String();
+	String string = StringTable::intern((const char *) input->cursor, length - 1);
+	input->cursor += length - 1;
+	return string;
+}
+
+const String &SkeletonBinary::readStringRef(DataInput *input, SkeletonData *skeletonData) {
 	int index = readVarint(input, true);
-	return index == 0 ? NULL : skeletonData->_strings[index - 1];
+	return skeletonData->_strings[index];
 }
 
 float SkeletonBinary::readFloat(DataInput *input) {
@@ -502,9 +592,9 @@ Skin *SkeletonBinary::readSkin(DataInput *input, bool defaultSkin, SkeletonData
 	if (defaultSkin) {
 		slotCount = readVarint(input, true);
 		if (slotCount == 0) return NULL;
-		skin = new (__FILE__, __LINE__) Skin("default");
+		skin = new (__FILE__, __LINE__) Skin(StringTable::intern("default"));
 	} else {
-		skin = new (__FILE__, __LINE__) Skin(String(readString(input), true));
+		skin = new (__FILE__, __LINE__) Skin(readInternedString(input));
 
 		if (nonessential) readColor(input, skin->getColor());
 
@@ -566,6 +656,9 @@ Sequence *SkeletonBinary::readSequence(DataInput *input) {
 
 Attachment *SkeletonBinary::readAttachment(DataInput *input, Skin *skin, int slotIndex, const String &attachmentName,
 										   SkeletonData *skeletonData, bool nonessential) {
+	// A custom attachment loader may allocate memory it frees itself, which must not come from the data's arena.
+	ArenaScope loaderScope;
+	if (!_atlasLoader) loaderScope.enter(NULL);
 
 	int flags = readByte(input);
 	String name = (flags & 8) != 0 ? readStringRef(input, skeletonData) : attachmentName;
@@ -651,6 +744,7 @@ Attachment *SkeletonBinary::readAttachment(DataInput *input, Skin *skin, int slo
 			mesh->_bones.addAll(bones);
 			mesh->_vertices.addAll(vertices);
 			mesh->setWorldVerticesLength(verticesLength);
+			mesh->updateBounds();
 			mesh->_triangles.addAll(triangles);
 			mesh->_regionUVs.addAll(uvs);
 			if (sequence == NULL) mesh->updateRegion();
@@ -691,6 +785,8 @@ Attachment *SkeletonBinary::readAttachment(DataInput *input, Skin *skin, int slo
 				mesh->_height = height;
 			}
 
+			// Linked meshes are owned by the loader, so they are not allocated from the arena.
+			ArenaScope arenaScope(NULL);
 			LinkedMesh *linkedMesh = new (__FILE__, __LINE__) LinkedMesh(mesh, skinIndex, slotIndex,
 																		 String(parent), inheritTimelines);
 			_linkedMeshes.add(linkedMesh);
@@ -746,6 +842,7 @@ Attachment *SkeletonBinary::readAttachment(DataInput *input, Skin *skin, int slo
 			if (nonessential) {
 				readColor(input, clip->getColor());
 			}
+			clip->updateConvexPolygons();
 			_attachmentLoader->configureAttachment(clip);
 			return clip;
 		}
@@ -779,15 +876,22 @@ int SkeletonBinary::readVertices(DataInput *input, Vector<float> &vertices, Vect
 void SkeletonBinary::readFloatArray(DataInput *input, int n, float scale, Vector<float> &array) {
 	array.setSize(n, 0);
 
-	int i;
-	if (scale == 1) {
-		for (i = 0; i < n; ++i) {
-			array[i] = readFloat(input);
-		}
-	} else {
-		for (i = 0; i < n; ++i) {
-			array[i] = readFloat(input) * scale;
-		}
+	// Decodes the big endian floats directly from the input in a single pass.
+	float *values = array.buffer();
+	const unsigned char *cursor = input->cursor;
+	union {
+		unsigned int intValue;
+		float floatValue;
+	} intToFloat;
+	for (int i = 0; i < n; ++i, cursor += 4) {
+		intToFloat.intValue = ((unsigned int) cursor[0] << 24) | ((unsigned int) cursor[1] << 16) |
+							  ((unsigned int) cursor[2] << 8) | (unsigned int) cursor[3];
+		values[i] = intToFloat.floatValue;
+	}
+	input->cursor = cursor;
+	if (scale != 1) {
+		for (int i = 0; i < n; ++i)
+			values[i] *= scale;
 	}
 }
 
@@ -1328,11 +1432,11 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 		for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
 			int slotIndex = readVarint(input, true);
 			for (int iii = 0, nnn = readVarint(input, true); iii < nnn; iii++) {
-				const char *attachmentName = readStringRef(input, skeletonData);
-				Attachment *baseAttachment = skin->getAttachment(slotIndex, String(attachmentName));
+				const String &attachmentName = readStringRef(input, skeletonData);
+				Attachment *baseAttachment = skin->getAttachment(slotIndex, attachmentName);
 				if (!baseAttachment) {
 					ContainerUtil::cleanUpVectorOfPointers(timelines);
-					setError("Attachment not found: ", attachmentName);
+					setError("Attachment not found: ", attachmentName.buffer());
 					return NULL;
 				}
 				unsigned int timelineType = readByte(input);
@@ -1465,12 +1569,13 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 
 			event->_intValue = readVarint(input, false);
 			event->_floatValue = readFloat(input);
-			const char *event_stringValue = readString(input);
-			if (event_stringValue == nullptr) {
+			// No string means the event's data provides it, which differs from an empty string.
+			int length = readVarint(input, true);
+			if (length == 0) {
 				event->_stringValue = eventData->_stringValue;
 			} else {
-				event->_stringValue = String(event_stringValue);
-				SpineExtension::free(event_stringValue, __FILE__, __LINE__);
+				event->_stringValue = StringTable::intern((const char *) input->cursor, length - 1);
+				input->cursor += length - 1;
 			}
 
 			if (!eventData->_audioPath.isEmpty()) {
@@ -1482,9 +1587,367 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 		timelines.add(timeline);
 	}
 
+	if (_bezierSamples > 0) {
+		for (size_t i = 0; i < timelines.size(); i++) {
+			if (timelines[i]->getRTTI().instanceOf(CurveTimeline::rtti))
+				static_cast<CurveTimeline *>(timelines[i])->bakeBeziers(_bezierSamples);
+		}
+	}
+
 	float duration = 0;
 	for (int i = 0, n = (int) timelines.size(); i < n; i++) {
 		duration = MathUtil::max(duration, (timelines[i])->getDuration());
 	}
 	return new (__FILE__, __LINE__) Animation(String(name), timelines, duration);
 }
+
+// Finds the animations by skipping over them, then reads them as tasks. Skipping stops before an animation with an
+// invalid timeline type, which is left for the caller to read so it reports the error. Returns the number of animations
+// read, or -1 if reading one of them failed.
+int SkeletonBinary::readAnimations(DataInput *input, SkeletonData *skeletonData, int animationsCount) {
+	// Each task allocates from its own arena, merged into the skeleton data's arena afterward.
+	Arena *arena = Arena::getCurrent();
+	ArenaScope arenaScope(NULL);
+	Vector<AnimationTask> tasks;
+	tasks.setSize(animationsCount, AnimationTask());
+	int count = 0;
+	for (; count < animationsCount; count++) {
+		const unsigned char *start = input->cursor;
+		AnimationTask &task = tasks[count];
+		task.loader = this;
+		task.skeletonData = skeletonData;
+		task.name = readInternedString(input);
+		task.input.cursor = input->cursor;
+		task.input.end = input->end;
+		float duration;
+		if (!skipAnimation(input, skeletonData, duration, NULL)) {
+			input->cursor = start;
+			break;
+		}
+		if (arena) {
+			int blockSize = (int) (input->cursor - task.input.cursor) * 2;
+			task.arena = new (__FILE__, __LINE__) Arena(blockSize < 4096 ? 4096 : (blockSize > 65536 ? 65536 : blockSize));
+		}
+	}
+
+	_taskRunner->run(count, readAnimationTask, tasks.buffer());
+
+	int failed = -1;
+	for (int i = 0; i < count; i++) {
+		AnimationTask &task = tasks[i];
+		if (task.arena) arena->merge(task.arena);
+		skeletonData->_animations[i] = task.animation;
+		if (!task.animation && failed == -1) failed = i;
+	}
+	if (failed != -1) {
+		_error = tasks[failed].error;
+		return -1;
+	}
+	return count;
+}
+
+void SkeletonBinary::readAnimationTask(void *context, size_t index) {
+	AnimationTask &task = ((AnimationTask *) context)[index];
+	ArenaScope arenaScope(task.arena);
+	// A loader per task, so errors are not set on the shared loader concurrently.
+	SkeletonBinary loader(task.loader->_attachmentLoader);
+	loader._scale = task.loader->_scale;
+	loader._bezierSamples = task.loader->_bezierSamples;
+	task.animation = loader.readAnimation(task.name, &task.input, task.skeletonData);
+	if (!task.animation) {
+		ArenaScope errorScope(NULL);
+		task.error = loader._error;
+	}
+}
+
+// Advances past an animation the same way readAnimation() reads it, without allocating, and computes its duration. If
+// attachmentKeys is not NULL, the slot index and string index of each attachment timeline key are added to it. Returns
+// false for an invalid timeline type or if the animation does not end within the input.
+bool SkeletonBinary::skipAnimation(DataInput *input, SkeletonData *skeletonData, float &duration,
+								   Vector<int> *attachmentKeys) {
+	duration = 0;
+	float time = 0;
+	readVarint(input, true);
+
+	// Slot timelines.
+	for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+		int slotIndex = readVarint(input, true);
+		for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
+			unsigned char timelineType = readByte(input);
+			int frameCount = readVarint(input, true);
+			if (timelineType == SLOT_ATTACHMENT) {
+				for (int frame = 0; frame < frameCount; ++frame) {
+					time = readFloat(input);
+					int stringIndex = readVarint(input, true);
+					if (attachmentKeys) {
+						attachmentKeys->add(slotIndex);
+						attachmentKeys->add(stringIndex);
+					}
+				}
+				duration = MathUtil::max(duration, time);
+				continue;
+			}
+			int channels;
+			switch (timelineType) {
+				case SLOT_RGBA:
+					channels = 4;
+					break;
+				case SLOT_RGB:
+					channels = 3;
+					break;
+				case SLOT_RGBA2:
+					channels = 7;
+					break;
+				case SLOT_RGB2:
+					channels = 6;
+					break;
+				case SLOT_ALPHA:
+					channels = 1;
+					break;
+				default:
+					return false;
+			}
+			readVarint(input, true);
+			skipCurveFrames(input, frameCount, 4 + channels, channels, duration);
+		}
+	}
+
+	// Bone timelines.
+	for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+		readVarint(input, true);
+		for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
+			unsigned char timelineType = readByte(input);
+			int frameCount = readVarint(input, true);
+			if (timelineType == BONE_INHERIT) {
+				for (int frame = 0; frame < frameCount; frame++) {
+					time = readFloat(input);
+					input->cursor += 1;
+				}
+				duration = MathUtil::max(duration, time);
+				continue;
+			}
+			readVarint(input, true);
+			switch (timelineType) {
+				case BONE_ROTATE:
+				case BONE_TRANSLATEX:
+				case BONE_TRANSLATEY:
+				case BONE_SCALEX:
+				case BONE_SCALEY:
+				case BONE_SHEARX:
+				case BONE_SHEARY:
+					skipCurveFrames(input, frameCount, 8, 1, duration);
+					break;
+				case BONE_TRANSLATE:
+				case BONE_SCALE:
+				case BONE_SHEAR:
+					skipCurveFrames(input, frameCount, 12, 2, duration);
+					break;
+				default:
+					return false;
+			}
+		}
+	}
+
+	// IK timelines.
+	for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+		readVarint(input, true);
+		int frameCount = readVarint(input, true);
+		readVarint(input, true);
+		for (int frame = 0; frame < frameCount; frame++) {
+			int flags = readByte(input);
+			time = readFloat(input);
+			if ((flags & 1) != 0 && (flags & 2) != 0) input->cursor += 4;
+			if ((flags & 4) != 0) input->cursor += 4;
+			if (frame > 0 && (flags & 64) == 0 && (flags & 128) != 0) input->cursor += 2 * 16;
+		}
+		duration = MathUtil::max(duration, time);
+	}
+
+	// Transform constraint timelines.
+	for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+		readVarint(input, true);
+		int frameCount = readVarint(input, true);
+		readVarint(input, true);
+		skipCurveFrames(input, frameCount, 28, 6, duration);
+	}
+
+	// Path constraint timelines.
+	for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+		readVarint(input, true);
+		for (int ii = 0, nn = readVarint(input, true); ii < nn; ii++) {
+			int type = readByte(input);
+			int frameCount = readVarint(input, true);
+			readVarint(input, true);
+			switch (type) {
+				case PATH_POSITION:
+				case PATH_SPACING:
+					skipCurveFrames(input, frameCount, 8, 1, duration);
+					break;
+				case PATH_MIX:
+					skipCurveFrames(input, frameCount, 16, 3, duration);
+			}
+		}
+	}
+
+	// Physics timelines.
+	for (int i = 0, n = readVarint(input, true); i < n; i++) {
+		readVarint(input, true);
+		for (int ii = 0, nn = readVarint(input, true); ii < nn; ii++) {
+			int type = readByte(input);
+			int frameCount = readVarint(input, true);
+			if (type == PHYSICS_RESET) {
+				for (int frame = 0; frame < frameCount; frame++)
+					time = readFloat(input);
+				duration = MathUtil::max(duration, time);
+				continue;
+			}
+			readVarint(input, true);
+			switch (type) {
+				case PHYSICS_INERTIA:
+				case PHYSICS_STRENGTH:
+				case PHYSICS_DAMPING:
+				case PHYSICS_MASS:
+				case PHYSICS_WIND:
+				case PHYSICS_GRAVITY:
+				case PHYSICS_MIX:
+					skipCurveFrames(input, frameCount, 8, 1, duration);
+			}
+		}
+	}
+
+	// Attachment timelines.
+	for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+		readVarint(input, true);
+		for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
+			readVarint(input, true);
+			for (int iii = 0, nnn = readVarint(input, true); iii < nnn; iii++) {
+				readVarint(input, true);
+				unsigned int timelineType = readByte(input);
+				int frameCount = readVarint(input, true);
+				switch (timelineType) {
+					case ATTACHMENT_DEFORM: {
+						readVarint(input, true);
+						time = readFloat(input);
+						for (int frame = 0;; ++frame) {
+							int end = readVarint(input, true);
+							if (end != 0) {
+								readVarint(input, true);
+								input->cursor += end * 4;
+							}
+							if (frame >= frameCount - 1) break;
+							time = readFloat(input);
+							if (readSByte(input) == CURVE_BEZIER) input->cursor += 16;
+						}
+						duration = MathUtil::max(duration, time);
+						break;
+					}
+					case ATTACHMENT_SEQUENCE:
+						for (int frame = 0; frame < frameCount; frame++) {
+							time = readFloat(input);
+							input->cursor += 8;
+						}
+						duration = MathUtil::max(duration, time);
+						break;
+				}
+			}
+		}
+	}
+
+	// Draw order timeline.
+	for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+		duration = MathUtil::max(duration, readFloat(input));
+		for (int ii = 0, nn = readVarint(input, true); ii < nn; ++ii) {
+			readVarint(input, true);
+			readVarint(input, true);
+		}
+	}
+
+	// Event timeline.
+	for (int i = 0, n = readVarint(input, true); i < n; ++i) {
+		duration = MathUtil::max(duration, readFloat(input));
+		EventData *eventData = skeletonData->_events[readVarint(input, true)];
+		readVarint(input, false);
+		input->cursor += 4;
+		int length = readVarint(input, true);
+		if (length > 0) input->cursor += length - 1;
+		if (!eventData->_audioPath.isEmpty()) input->cursor += 8;
+	}
+
+	return input->cursor <= input->end;
+}
+
+// Skips the frames of a curve timeline, each frameSize bytes starting with its time. Every frame after the first is
+// followed by its curve type and, for a bezier curve, the control points of its curves.
+void SkeletonBinary::skipCurveFrames(DataInput *input, int frameCount, int frameSize, int curves, float &duration) {
+	float time = readFloat(input);
+	input->cursor += frameSize - 4;
+	for (int frame = 1; frame < frameCount; frame++) {
+		time = readFloat(input);
+		input->cursor += frameSize - 4;
+		if (readSByte(input) == CURVE_BEZIER) input->cursor += curves * 16;
+	}
+	duration = MathUtil::max(duration, time);
+}
+
+// Creates animations without timelines that are decoded by the skeleton data when first used, see
+// SkeletonData::loadAnimation(). Stops before an animation with an invalid timeline type, like readAnimations().
+int SkeletonBinary::readLazyAnimations(DataInput *input, SkeletonData *skeletonData, int animationsCount,
+									   Vector<int> &attachmentKeys) {
+	const unsigned char *start = input->cursor;
+	{
+		// Animations are the last part of the data.
+		ArenaScope arenaScope(NULL);
+		SkeletonBinary *reader = new (__FILE__, __LINE__) SkeletonBinary(_scale, _bezierSamples);
+		reader->_animationData.setSize(input->end - start, 0);
+		memcpy(reader->_animationData.buffer(), start, input->end - start);
+		skeletonData->_animationReader = reader;
+	}
+
+	Vector<Timeline *> timelines;
+	int count = 0;
+	for (; count < animationsCount; count++) {
+		const unsigned char *animationStart = input->cursor;
+		String name = readInternedString(input);
+		size_t offset = input->cursor - start;
+		float duration;
+		if (!skipAnimation(input, skeletonData, duration, &attachmentKeys)) {
+			input->cursor = animationStart;
+			break;
+		}
+		Animation *animation = new (__FILE__, __LINE__) Animation(name, timelines, duration);
+		animation->_lazyData = skeletonData;
+		animation->_lazyOffset = offset;
+		animation->_loaded = false;
+		skeletonData->_animations[count] = animation;
+	}
+	return count;
+}
+
+bool SkeletonBinary::readLazyAnimation(Animation *animation, SkeletonData *skeletonData) {
+	// Lazily read animations are loaded and unloaded individually, so they are not allocated from the data's arena.
+	ArenaScope arenaScope(NULL);
+	DataInput input;
+	input.cursor = _animationData.buffer() + animation->_lazyOffset;
+	input.end = _animationData.buffer() + _animationData.size();
+	Animation *decoded = readAnimation(animation->_name, &input, skeletonData);
+	if (!decoded) return false;
+	animation->setTimelines(decoded->_timelines);
+	decoded->_timelines.clear();
+	delete decoded;
+
+	// The data's attachment keys include the keys of lazily read animations, see readLazyAnimations(). They are only
+	// looked up, since skeletons may be reading them.
+	Vector<Timeline *> &timelines = animation->_timelines;
+	for (size_t i = 0; i < timelines.size(); i++) {
+		if (!timelines[i]->getRTTI().isExactly(AttachmentTimeline::rtti)) continue;
+		AttachmentTimeline *timeline = static_cast<AttachmentTimeline *>(timelines[i]);
+		int slotIndex = timeline->getSlotIndex();
+		if (slotIndex < 0 || slotIndex >= (int) skeletonData->_slots.size()) continue;
+		SlotData &slot = *skeletonData->_slots[slotIndex];
+		Vector<String> &names = timeline->getAttachmentNames();
+		Vector<int> &ids = timeline->getAttachmentIds();
+		for (size_t frame = 0; frame < names.size(); frame++)
+			ids[frame] = SkeletonData::findAttachmentId(slot, names[frame]);
+	}
+	return true;
+}
\ No newline at end of file
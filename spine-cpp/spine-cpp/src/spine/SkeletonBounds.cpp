@@ -39,7 +39,7 @@
 
 using namespace spine;
 
-SkeletonBounds::SkeletonBounds() : _minX(0), _minY(0), _maxX(0), _maxY(0) {
+SkeletonBounds::SkeletonBounds() : _minX(0), _minY(0), _maxX(0), _maxY(0), _aabbValid(false) {
 }
 
 SkeletonBounds::~SkeletonBounds() {
@@ -52,13 +52,8 @@ void SkeletonBounds::update(Skeleton &skeleton, bool updateAabb) {
 	Vector<Slot *> &slots = skeleton.getSlots();
 	size_t slotCount = slots.size();
 
-	_boundingBoxes.clear();
-	for (size_t i = 0, n = _polygons.size(); i < n; ++i) {
-		_polygonPool.free(_polygons[i]);
-	}
-
-	_polygons.clear();
-
+	size_t polygonCount = 0;
+	bool changed = false;
 	for (size_t i = 0; i < slotCount; i++) {
 		Slot *slot = slots[i];
 		if (!slot->getBone().isActive()) continue;
@@ -66,24 +61,32 @@ void SkeletonBounds::update(Skeleton &skeleton, bool updateAabb) {
 		Attachment *attachment = slot->getAttachment();
 		if (attachment == NULL || !attachment->getRTTI().instanceOf(BoundingBoxAttachment::rtti)) continue;
 		BoundingBoxAttachment *boundingBox = static_cast<BoundingBoxAttachment *>(attachment);
-		_boundingBoxes.add(boundingBox);
-
-		spine::Polygon *polygonP = _polygonPool.obtain();
-		_polygons.add(polygonP);
 
-		Polygon &polygon = *polygonP;
-
-		size_t count = boundingBox->getWorldVerticesLength();
-		polygon._count = (int) count;
-		if (polygon._vertices.size() < count) {
-			polygon._vertices.setSize(count, 0);
+		if (polygonCount == _polygons.size()) {
+			_polygons.add(_polygonPool.obtain());
+			_boundingBoxes.add(NULL);
+			_slots.add(NULL);
+			_boneTransforms.setSize(_boneTransforms.size() + 6, 0);
 		}
-		boundingBox->computeWorldVertices(*slot, polygon._vertices);
+		if (updatePolygon(polygonCount, *slot, *boundingBox)) changed = true;
+		polygonCount++;
+	}
+
+	if (polygonCount < _polygons.size()) {
+		for (size_t i = polygonCount, n = _polygons.size(); i < n; ++i)
+			_polygonPool.free(_polygons[i]);
+		_polygons.setSize(polygonCount, NULL);
+		_boundingBoxes.setSize(polygonCount, NULL);
+		_slots.setSize(polygonCount, NULL);
+		_boneTransforms.setSize(polygonCount * 6, 0);
+		changed = true;
 	}
 
-	if (updateAabb)
-		aabbCompute();
-	else {
+	if (updateAabb) {
+		if (changed || !_aabbValid) aabbCompute();
+		_aabbValid = true;
+	} else {
+		_aabbValid = false;
 		_minX = FLT_MIN;
 		_minY = FLT_MIN;
 		_maxX = FLT_MAX;
@@ -118,7 +121,7 @@ bool SkeletonBounds::aabbintersectsSegment(float x1, float y1, float x2, float y
 	return false;
 }
 
-bool SkeletonBounds::aabbIntersectsSkeleton(SkeletonBounds bounds) {
+bool SkeletonBounds::aabbIntersectsSkeleton(SkeletonBounds &bounds) {
 	return _minX < bounds._maxX && _maxX > bounds._minX && _minY < bounds._maxY && _maxY > bounds._minY;
 }
 
@@ -143,14 +146,22 @@ bool SkeletonBounds::containsPoint(spine::Polygon *polygon, float x, float y) {
 }
 
 BoundingBoxAttachment *SkeletonBounds::containsPoint(float x, float y) {
-	for (size_t i = 0, n = _polygons.size(); i < n; ++i)
-		if (containsPoint(_polygons[i], x, y)) return _boundingBoxes[i];
+	for (size_t i = 0, n = _polygons.size(); i < n; ++i) {
+		Polygon *polygon = _polygons[i];
+		if (x < polygon->_minX || x > polygon->_maxX || y < polygon->_minY || y > polygon->_maxY) continue;
+		if (containsPoint(polygon, x, y)) return _boundingBoxes[i];
+	}
 	return NULL;
 }
 
 BoundingBoxAttachment *SkeletonBounds::intersectsSegment(float x1, float y1, float x2, float y2) {
-	for (size_t i = 0, n = _polygons.size(); i < n; ++i)
-		if (intersectsSegment(_polygons[i], x1, y1, x2, y2)) return _boundingBoxes[i];
+	float minX = MathUtil::min(x1, x2), maxX = MathUtil::max(x1, x2);
+	float minY = MathUtil::min(y1, y2), maxY = MathUtil::max(y1, y2);
+	for (size_t i = 0, n = _polygons.size(); i < n; ++i) {
+		Polygon *polygon = _polygons[i];
+		if (maxX < polygon->_minX || minX > polygon->_maxX || maxY < polygon->_minY || minY > polygon->_maxY) continue;
+		if (intersectsSegment(polygon, x1, y1, x2, y2)) return _boundingBoxes[i];
+	}
 	return NULL;
 }
 
@@ -206,6 +217,65 @@ float SkeletonBounds::getHeight() {
 	return _maxY - _minY;
 }
 
+float SkeletonBounds::getMinX() {
+	return _minX;
+}
+
+float SkeletonBounds::getMinY() {
+	return _minY;
+}
+
+float SkeletonBounds::getMaxX() {
+	return _maxX;
+}
+
+float SkeletonBounds::getMaxY() {
+	return _maxY;
+}
+
+bool SkeletonBounds::updatePolygon(size_t index, Slot &slot, BoundingBoxAttachment &boundingBox) {
+	Bone &bone = slot.getBone();
+	float *transform = _boneTransforms.buffer() + index * 6;
+	// The world vertices of an unweighted, undeformed attachment only depend on the bone's world transform. Polygons
+	// computed from weights or a deform are not cached, _slots is NULL for them.
+	if (_slots[index] == &slot && _boundingBoxes[index] == &boundingBox && transform[0] == bone.getA() &&
+		transform[1] == bone.getB() && transform[2] == bone.getC() && transform[3] == bone.getD() &&
+		transform[4] == bone.getWorldX() && transform[5] == bone.getWorldY() && slot.getDeform().size() == 0)
+		return false;
+	bool cacheable = boundingBox.getBones().size() == 0 && slot.getDeform().size() == 0;
+	_slots[index] = cacheable ? &slot : NULL;
+	_boundingBoxes[index] = &boundingBox;
+	transform[0] = bone.getA();
+	transform[1] = bone.getB();
+	transform[2] = bone.getC();
+	transform[3] = bone.getD();
+	transform[4] = bone.getWorldX();
+	transform[5] = bone.getWorldY();
+
+	Polygon &polygon = *_polygons[index];
+	size_t count = boundingBox.getWorldVerticesLength();
+	polygon._count = (int) count;
+	if (polygon._vertices.size() < count) {
+		polygon._vertices.setSize(count, 0);
+	}
+	boundingBox.computeWorldVertices(slot, polygon._vertices);
+
+	float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+	float *vertices = polygon._vertices.buffer();
+	for (size_t i = 0; i < count; i += 2) {
+		float x = vertices[i], y = vertices[i + 1];
+		minX = MathUtil::min(minX, x);
+		minY = MathUtil::min(minY, y);
+		maxX = MathUtil::max(maxX, x);
+		maxY = MathUtil::max(maxY, y);
+	}
+	polygon._minX = minX;
+	polygon._minY = minY;
+	polygon._maxX = maxX;
+	polygon._maxY = maxY;
+	return true;
+}
+
 void SkeletonBounds::aabbCompute() {
 	float minX = FLT_MAX;
 	float minY = FLT_MAX;
@@ -214,15 +284,10 @@ void SkeletonBounds::aabbCompute() {
 
 	for (size_t i = 0, n = _polygons.size(); i < n; ++i) {
 		spine::Polygon *polygon = _polygons[i];
-		Vector<float> &vertices = polygon->_vertices;
-		for (int ii = 0, nn = polygon->_count; ii < nn; ii += 2) {
-			float x = vertices[ii];
-			float y = vertices[ii + 1];
-			minX = MathUtil::min(minX, x);
-			minY = MathUtil::min(minY, y);
-			maxX = MathUtil::max(maxX, x);
-			maxY = MathUtil::max(maxY, y);
-		}
+		minX = MathUtil::min(minX, polygon->_minX);
+		minY = MathUtil::min(minY, polygon->_minY);
+		maxX = MathUtil::max(maxX, polygon->_maxX);
+		maxY = MathUtil::max(maxY, polygon->_maxY);
 	}
 	_minX = minX;
 	_minY = minY;
@@ -0,0 +1,266 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/SkeletonBoundsGrid.h>
+
+#include <spine/MathUtil.h>
+#include <spine/SkeletonBounds.h>
+
+#include <limits.h>
+
+using namespace spine;
+
+// Bounds spanning more cells than this on either axis are tested by every query instead of being hashed.
+static const int maxCellSpan = 4;
+static const int emptyCells = INT_MAX;
+static const int largeCells = INT_MIN;
+// Keeps cell coordinates far from overflowing when hashed.
+static const float maxCell = 1 << 30;
+
+SkeletonBoundsGrid::SkeletonBoundsGrid(float cellSize) : _cellSize(cellSize > 0 ? cellSize : 1), _stamp(0), _dirty(true) {
+}
+
+SkeletonBoundsGrid::~SkeletonBoundsGrid() {
+}
+
+void SkeletonBoundsGrid::add(SkeletonBounds *bounds) {
+	_bounds.add(bounds);
+	for (int i = 0; i < 4; i++)
+		_cells.add(emptyCells);
+	_stamps.add(0);
+	_dirty = true;
+}
+
+void SkeletonBoundsGrid::remove(SkeletonBounds *bounds) {
+	int index = _bounds.indexOf(bounds);
+	if (index == -1) return;
+	_bounds.removeAt(index);
+	for (int i = 0; i < 4; i++)
+		_cells.removeAt(index * 4);
+	_stamps.removeAt(index);
+	_dirty = true;
+}
+
+void SkeletonBoundsGrid::clear() {
+	_bounds.clear();
+	_cells.clear();
+	_stamps.clear();
+	_large.clear();
+	_bucketStarts.clear();
+	_entries.clear();
+	_dirty = true;
+}
+
+Vector<SkeletonBounds *> &SkeletonBoundsGrid::getBounds() {
+	return _bounds;
+}
+
+float SkeletonBoundsGrid::getCellSize() {
+	return _cellSize;
+}
+
+void SkeletonBoundsGrid::update() {
+	bool changed = _dirty;
+	int *cells = _cells.buffer();
+	for (size_t i = 0, n = _bounds.size(); i < n; i++, cells += 4)
+		if (computeCells(*_bounds[i], cells)) changed = true;
+	if (changed) rehash();
+	_dirty = false;
+}
+
+bool SkeletonBoundsGrid::computeCells(SkeletonBounds &bounds, int *cells) {
+	int minX, minY, maxX, maxY;
+	if (bounds.getPolygons().size() == 0) {
+		minX = minY = maxX = maxY = emptyCells;
+	} else {
+		float span = maxCellSpan * _cellSize;
+		// Also true for infinite or NaN bounds.
+		if (!(bounds.getMaxX() - bounds.getMinX() < span && bounds.getMaxY() - bounds.getMinY() < span))
+			minX = minY = maxX = maxY = largeCells;
+		else {
+			minX = cell(bounds.getMinX());
+			minY = cell(bounds.getMinY());
+			maxX = cell(bounds.getMaxX());
+			maxY = cell(bounds.getMaxY());
+		}
+	}
+	if (cells[0] == minX && cells[1] == minY && cells[2] == maxX && cells[3] == maxY) return false;
+	cells[0] = minX;
+	cells[1] = minY;
+	cells[2] = maxX;
+	cells[3] = maxY;
+	return true;
+}
+
+void SkeletonBoundsGrid::rehash() {
+	size_t bucketCount = 16;
+	while (bucketCount < _bounds.size() * 2)
+		bucketCount <<= 1;
+	_bucketStarts.setSize(bucketCount + 1, 0);
+	int *starts = _bucketStarts.buffer();
+	for (size_t i = 0; i <= bucketCount; i++)
+		starts[i] = 0;
+
+	// Counts the entries of each bucket, then stores the buckets' entries contiguously.
+	_large.clear();
+	int *cells = _cells.buffer();
+	size_t entryCount = 0;
+	for (size_t i = 0, n = _bounds.size(); i < n; i++, cells += 4) {
+		if (cells[0] == emptyCells) continue;
+		if (cells[0] == largeCells) {
+			_large.add((int) i);
+			continue;
+		}
+		for (int y = cells[1]; y <= cells[3]; y++) {
+			for (int x = cells[0]; x <= cells[2]; x++) {
+				starts[bucket(x, y) + 1]++;
+				entryCount++;
+			}
+		}
+	}
+	for (size_t i = 0; i < bucketCount; i++)
+		starts[i + 1] += starts[i];
+
+	_entries.setSize(entryCount, 0);
+	int *entries = _entries.buffer();
+	cells = _cells.buffer();
+	for (size_t i = 0, n = _bounds.size(); i < n; i++, cells += 4) {
+		if (cells[0] == emptyCells || cells[0] == largeCells) continue;
+		for (int y = cells[1]; y <= cells[3]; y++) {
+			for (int x = cells[0]; x <= cells[2]; x++)
+				entries[starts[bucket(x, y)]++] = (int) i;
+		}
+	}
+	// Filling advanced each start to the next bucket's start.
+	for (size_t i = bucketCount; i > 0; i--)
+		starts[i] = starts[i - 1];
+	starts[0] = 0;
+}
+
+int SkeletonBoundsGrid::cell(float v) {
+	float c = MathUtil::floor(v / _cellSize);
+	return (int) MathUtil::clamp(c, -maxCell, maxCell);
+}
+
+size_t SkeletonBoundsGrid::bucket(int x, int y) {
+	return (((unsigned int) x * 73856093u) ^ ((unsigned int) y * 19349663u)) & (unsigned int) (_bucketStarts.size() - 2);
+}
+
+unsigned int SkeletonBoundsGrid::nextStamp() {
+	if (++_stamp == 0) {
+		for (size_t i = 0, n = _stamps.size(); i < n; i++)
+			_stamps[i] = 0;
+		_stamp = 1;
+	}
+	return _stamp;
+}
+
+size_t SkeletonBoundsGrid::containsPoint(float x, float y, Vector<SkeletonBounds *> &outBounds,
+										 Vector<BoundingBoxAttachment *> &outBoundingBoxes) {
+	outBounds.clear();
+	outBoundingBoxes.clear();
+	if (_dirty) update();
+	nextStamp();
+
+	if (_entries.size() > 0) {
+		size_t b = bucket(cell(x), cell(y));
+		for (int i = _bucketStarts[b], n = _bucketStarts[b + 1]; i < n; i++)
+			queryPoint(_entries[i], x, y, outBounds, outBoundingBoxes);
+	}
+	for (size_t i = 0, n = _large.size(); i < n; i++)
+		queryPoint(_large[i], x, y, outBounds, outBoundingBoxes);
+	return outBoundingBoxes.size();
+}
+
+size_t SkeletonBoundsGrid::intersectsSegment(float x1, float y1, float x2, float y2, Vector<SkeletonBounds *> &outBounds,
+											 Vector<BoundingBoxAttachment *> &outBoundingBoxes) {
+	outBounds.clear();
+	outBoundingBoxes.clear();
+	if (_dirty) update();
+	nextStamp();
+
+	int minX = cell(MathUtil::min(x1, x2)), maxX = cell(MathUtil::max(x1, x2));
+	int minY = cell(MathUtil::min(y1, y2)), maxY = cell(MathUtil::max(y1, y2));
+	// Long segments visit more cells than it takes to test every bounds.
+	if ((float) (maxX - minX + 1) * (float) (maxY - minY + 1) > (float) _bounds.size()) {
+		int *cells = _cells.buffer();
+		for (size_t i = 0, n = _bounds.size(); i < n; i++, cells += 4)
+			if (cells[0] != emptyCells) querySegment((int) i, x1, y1, x2, y2, outBounds, outBoundingBoxes);
+		return outBoundingBoxes.size();
+	}
+
+	if (_entries.size() > 0) {
+		for (int y = minY; y <= maxY; y++) {
+			for (int x = minX; x <= maxX; x++) {
+				size_t b = bucket(x, y);
+				for (int i = _bucketStarts[b], n = _bucketStarts[b + 1]; i < n; i++)
+					querySegment(_entries[i], x1, y1, x2, y2, outBounds, outBoundingBoxes);
+			}
+		}
+	}
+	for (size_t i = 0, n = _large.size(); i < n; i++)
+		querySegment(_large[i], x1, y1, x2, y2, outBounds, outBoundingBoxes);
+	return outBoundingBoxes.size();
+}
+
+void SkeletonBoundsGrid::queryPoint(int index, float x, float y, Vector<SkeletonBounds *> &outBounds,
+									Vector<BoundingBoxAttachment *> &outBoundingBoxes) {
+	if (_stamps[index] == _stamp) return;
+	_stamps[index] = _stamp;
+	SkeletonBounds *bounds = _bounds[index];
+	if (!bounds->aabbcontainsPoint(x, y)) return;
+	Vector<Polygon *> &polygons = bounds->getPolygons();
+	for (size_t i = 0, n = polygons.size(); i < n; i++) {
+		Polygon *polygon = polygons[i];
+		if (x < polygon->_minX || x > polygon->_maxX || y < polygon->_minY || y > polygon->_maxY) continue;
+		if (bounds->containsPoint(polygon, x, y)) {
+			outBounds.add(bounds);
+			outBoundingBoxes.add(bounds->getBoundingBoxes()[i]);
+		}
+	}
+}
+
+void SkeletonBoundsGrid::querySegment(int index, float x1, float y1, float x2, float y2, Vector<SkeletonBounds *> &outBounds,
+									  Vector<BoundingBoxAttachment *> &outBoundingBoxes) {
+	if (_stamps[index] == _stamp) return;
+	_stamps[index] = _stamp;
+	SkeletonBounds *bounds = _bounds[index];
+	if (!bounds->aabbintersectsSegment(x1, y1, x2, y2)) return;
+	float minX = MathUtil::min(x1, x2), maxX = MathUtil::max(x1, x2);
+	float minY = MathUtil::min(y1, y2), maxY = MathUtil::max(y1, y2);
+	Vector<Polygon *> &polygons = bounds->getPolygons();
+	for (size_t i = 0, n = polygons.size(); i < n; i++) {
+		Polygon *polygon = polygons[i];
+		if (maxX < polygon->_minX || minX > polygon->_maxX || maxY < polygon->_minY || minY > polygon->_maxY) continue;
+		if (bounds->intersectsSegment(polygon, x1, y1, x2, y2)) {
+			outBounds.add(bounds);
+			outBoundingBoxes.add(bounds->getBoundingBoxes()[i]);
+		}
+	}
+}
@@ -29,18 +29,125 @@
 
 #include <spine/SkeletonClipping.h>
 
+#include <spine/Bone.h>
 #include <spine/ClippingAttachment.h>
 #include <spine/Slot.h>
 
+#include <string.h>
+
+#if !defined(SPINE_NO_SIMD) && (defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+#include <xmmintrin.h>
+#define SPINE_SIMD_SSE
+#elif !defined(SPINE_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define SPINE_SIMD_NEON
+#endif
+
 using namespace spine;
 
-SkeletonClipping::SkeletonClipping() : _clipAttachment(NULL) {
+// How a triangle relates to one convex clipping polygon.
+enum {
+	Triangle_Clipped = 0,
+	Triangle_Inside = 1,
+	Triangle_Outside = 2
+};
+
+// Trivial accept and reject for one triangle, using the same side test as clip(). x and y hold the 3 vertices, bounds
+// the polygon's min x, min y, max x and max y.
+static unsigned char classifyTriangle(const float *x, const float *y, Vector<float> &polygon, const float *bounds) {
+	if ((x[0] < bounds[0] && x[1] < bounds[0] && x[2] < bounds[0]) ||
+		(y[0] < bounds[1] && y[1] < bounds[1] && y[2] < bounds[1]) ||
+		(x[0] > bounds[2] && x[1] > bounds[2] && x[2] > bounds[2]) ||
+		(y[0] > bounds[3] && y[1] > bounds[3] && y[2] > bounds[3]))
+		return Triangle_Outside;
+
+	bool inside = true;
+	float *vertices = polygon.buffer();
+	for (size_t i = 0, n = polygon.size() - 2; i < n; i += 2) {
+		float edgeX = vertices[i], edgeY = vertices[i + 1];
+		float ex = edgeX - vertices[i + 2], ey = edgeY - vertices[i + 3];
+		int count = 0;
+		for (int ii = 0; ii < 3; ii++)
+			if (ey * (edgeX - x[ii]) - ex * (edgeY - y[ii]) > 0) count++;
+		if (count == 0) return Triangle_Outside;
+		if (count < 3) inside = false;
+	}
+	return inside ? Triangle_Inside : Triangle_Clipped;
+}
+
+#if defined(SPINE_SIMD_SSE) || defined(SPINE_SIMD_NEON)
+#ifdef SPINE_SIMD_SSE
+typedef __m128 float4;
+#define load4(p) _mm_loadu_ps(p)
+#define set4(v) _mm_set1_ps(v)
+#define sub4(a, b) _mm_sub_ps(a, b)
+#define mul4(a, b) _mm_mul_ps(a, b)
+#define min4(a, b) _mm_min_ps(a, b)
+#define max4(a, b) _mm_max_ps(a, b)
+#define lessMask4(a, b) _mm_movemask_ps(_mm_cmplt_ps(a, b))
+#define greaterMask4(a, b) _mm_movemask_ps(_mm_cmpgt_ps(a, b))
+#else
+typedef float32x4_t float4;
+#define load4(p) vld1q_f32(p)
+#define set4(v) vdupq_n_f32(v)
+#define sub4(a, b) vsubq_f32(a, b)
+#define mul4(a, b) vmulq_f32(a, b)
+#define min4(a, b) vminq_f32(a, b)
+#define max4(a, b) vmaxq_f32(a, b)
+#define lessMask4(a, b) laneMask4(vcltq_f32(a, b))
+#define greaterMask4(a, b) laneMask4(vcgtq_f32(a, b))
+
+static inline int laneMask4(uint32x4_t mask) {
+	uint32_t lanes[4];
+	vst1q_u32(lanes, mask);
+	return (lanes[0] & 1) | (lanes[1] & 2) | (lanes[2] & 4) | (lanes[3] & 8);
+}
+#endif
+
+// classifyTriangle() for 4 triangles at once. x and y hold vertex k of triangle i at k * 4 + i.
+static void classifyTriangles4(const float *x, const float *y, Vector<float> &polygon, const float *bounds,
+							   unsigned char *out, size_t outStride) {
+	float4 x1 = load4(x), x2 = load4(x + 4), x3 = load4(x + 8);
+	float4 y1 = load4(y), y2 = load4(y + 4), y3 = load4(y + 8);
+	int outside = lessMask4(max4(max4(x1, x2), x3), set4(bounds[0])) |
+				  lessMask4(max4(max4(y1, y2), y3), set4(bounds[1])) |
+				  greaterMask4(min4(min4(x1, x2), x3), set4(bounds[2])) |
+				  greaterMask4(min4(min4(y1, y2), y3), set4(bounds[3]));
+	int inside = 15;
+
+	float *vertices = polygon.buffer();
+	float4 zero = set4(0);
+	for (size_t i = 0, n = polygon.size() - 2; i < n && outside != 15; i += 2) {
+		float edgeX = vertices[i], edgeY = vertices[i + 1];
+		float4 vedgeX = set4(edgeX), vedgeY = set4(edgeY);
+		float4 ex = set4(edgeX - vertices[i + 2]), ey = set4(edgeY - vertices[i + 3]);
+		int in1 = greaterMask4(sub4(mul4(ey, sub4(vedgeX, x1)), mul4(ex, sub4(vedgeY, y1))), zero);
+		int in2 = greaterMask4(sub4(mul4(ey, sub4(vedgeX, x2)), mul4(ex, sub4(vedgeY, y2))), zero);
+		int in3 = greaterMask4(sub4(mul4(ey, sub4(vedgeX, x3)), mul4(ex, sub4(vedgeY, y3))), zero);
+		inside &= in1 & in2 & in3;
+		outside |= ~(in1 | in2 | in3) & 15;
+	}
+
+	for (int i = 0; i < 4; i++, out += outStride) {
+		if (outside & (1 << i))
+			*out = Triangle_Outside;
+		else
+			*out = (inside & (1 << i)) ? Triangle_Inside : Triangle_Clipped;
+	}
+}
+#endif
+
+SkeletonClipping::SkeletonClipping() : _clipAttachment(NULL), _classifyTriangles(true) {
 	_clipOutput.ensureCapacity(128);
 	_clippedVertices.ensureCapacity(128);
 	_clippedTriangles.ensureCapacity(128);
 	_clippedUVs.ensureCapacity(128);
 }
 
+SkeletonClipping::~SkeletonClipping() {
+	clipEnd();
+}
+
 size_t SkeletonClipping::clipStart(Slot &slot, ClippingAttachment *clip) {
 	if (_clipAttachment != NULL) {
 		return 0;
@@ -48,6 +155,8 @@ size_t SkeletonClipping::clipStart(Slot &slot, ClippingAttachment *clip) {
 
 	_clipAttachment = clip;
 
+	if (transformConvexPolygons(slot, clip)) return _transformedPolygons.size();
+
 	int n = (int) clip->getWorldVerticesLength();
 	_clippingPolygon.setSize(n, 0);
 	clip->computeWorldVertices(slot, 0, n, _clippingPolygon, 0, 2);
@@ -65,6 +174,36 @@ size_t SkeletonClipping::clipStart(Slot &slot, ClippingAttachment *clip) {
 	return (*_clippingPolygons).size();
 }
 
+bool SkeletonClipping::transformConvexPolygons(Slot &slot, ClippingAttachment *clip) {
+	if (clip->_convexPolygonLengths.size() == 0 || clip->getBones().size() > 0 || slot.getDeform().size() > 0) return false;
+
+	Bone &bone = slot.getBone();
+	float a = bone.getA(), b = bone.getB(), c = bone.getC(), d = bone.getD();
+	float x = bone.getWorldX(), y = bone.getWorldY();
+	float det = a * d - b * c;
+	if (det == 0) return false;
+
+	// The triangulation only depends on the winding, so any transform that doesn't mirror gives the same convex pieces.
+	bool mirrored = det < 0;
+	Vector<int> &lengths = mirrored ? clip->_mirroredConvexPolygonLengths : clip->_convexPolygonLengths;
+	float *local = mirrored ? clip->_mirroredConvexPolygons.buffer() : clip->_convexPolygons.buffer();
+	for (size_t i = 0; i < lengths.size(); ++i) {
+		int n = lengths[i];
+		Vector<float> *polygon = _polygonPool.obtain();
+		polygon->setSize(n, 0);
+		float *world = polygon->buffer();
+		for (int ii = 0; ii < n; ii += 2) {
+			float vx = local[ii], vy = local[ii + 1];
+			world[ii] = vx * a + vy * b + x;
+			world[ii + 1] = vx * c + vy * d + y;
+		}
+		local += n;
+		_transformedPolygons.add(polygon);
+	}
+	_clippingPolygons = &_transformedPolygons;
+	return true;
+}
+
 void SkeletonClipping::clipEnd(Slot &slot) {
 	if (_clipAttachment != NULL && _clipAttachment->_endSlot == &slot._data) {
 		clipEnd();
@@ -76,12 +215,71 @@ void SkeletonClipping::clipEnd() {
 
 	_clipAttachment = NULL;
 	_clippingPolygons = NULL;
+	for (size_t i = 0; i < _transformedPolygons.size(); ++i)
+		_polygonPool.free(_transformedPolygons[i]);
+	_transformedPolygons.clear();
 	_clippedVertices.clear();
 	_clippedUVs.clear();
 	_clippedTriangles.clear();
 	_clippingPolygon.clear();
 }
 
+void SkeletonClipping::classifyTriangles(float *vertices, unsigned short *triangles, size_t trianglesLength,
+										 size_t stride) {
+	Vector<Vector<float> *> &polygons = *_clippingPolygons;
+	size_t polygonsCount = polygons.size();
+	size_t trianglesCount = trianglesLength / 3;
+	if (!_classifyTriangles) {
+		_triangleClasses.setSize(trianglesCount * polygonsCount, 0);
+		memset(_triangleClasses.buffer(), Triangle_Clipped, trianglesCount * polygonsCount);
+		return;
+	}
+
+	_polygonBounds.setSize(polygonsCount << 2, 0);
+	float *bounds = _polygonBounds.buffer();
+	for (size_t p = 0; p < polygonsCount; p++, bounds += 4) {
+		Vector<float> &polygon = *polygons[p];
+		bounds[0] = bounds[2] = polygon[0];
+		bounds[1] = bounds[3] = polygon[1];
+		for (size_t i = 2, n = polygon.size(); i < n; i += 2) {
+			float x = polygon[i], y = polygon[i + 1];
+			if (x < bounds[0]) bounds[0] = x;
+			else if (x > bounds[2]) bounds[2] = x;
+			if (y < bounds[1]) bounds[1] = y;
+			else if (y > bounds[3]) bounds[3] = y;
+		}
+	}
+	bounds = _polygonBounds.buffer();
+
+	_triangleClasses.setSize(trianglesCount * polygonsCount, 0);
+	unsigned char *classes = _triangleClasses.buffer();
+	size_t t = 0;
+#if defined(SPINE_SIMD_SSE) || defined(SPINE_SIMD_NEON)
+	for (; t + 4 <= trianglesCount; t += 4) {
+		float x[12], y[12];
+		for (int i = 0; i < 4; i++) {
+			for (int ii = 0; ii < 3; ii++) {
+				size_t vertexOffset = triangles[(t + i) * 3 + ii] * stride;
+				x[ii * 4 + i] = vertices[vertexOffset];
+				y[ii * 4 + i] = vertices[vertexOffset + 1];
+			}
+		}
+		for (size_t p = 0; p < polygonsCount; p++)
+			classifyTriangles4(x, y, *polygons[p], bounds + (p << 2), classes + t * polygonsCount + p, polygonsCount);
+	}
+#endif
+	for (; t < trianglesCount; t++) {
+		float x[3], y[3];
+		for (int ii = 0; ii < 3; ii++) {
+			size_t vertexOffset = triangles[t * 3 + ii] * stride;
+			x[ii] = vertices[vertexOffset];
+			y[ii] = vertices[vertexOffset + 1];
+		}
+		for (size_t p = 0; p < polygonsCount; p++)
+			classes[t * polygonsCount + p] = classifyTriangle(x, y, *polygons[p], bounds + (p << 2));
+	}
+}
+
 void SkeletonClipping::clipTriangles(float *vertices, unsigned short *triangles,
 									 size_t trianglesLength) {
 	Vector<float> &clipOutput = _clipOutput;
@@ -96,9 +294,12 @@ void SkeletonClipping::clipTriangles(float *vertices, unsigned short *triangles,
 	clippedTriangles.clear();
 
 	int stride = 2;
-	size_t i = 0;
-continue_outer:
-	for (; i < trianglesLength; i += 3) {
+	classifyTriangles(vertices, triangles, trianglesLength, stride);
+	unsigned char *classes = _triangleClasses.buffer();
+	clippedVertices.ensureCapacity(trianglesLength << 1);
+	clippedTriangles.ensureCapacity(trianglesLength);
+
+	for (size_t i = 0; i < trianglesLength; i += 3, classes += polygonsCount) {
 		int vertexOffset = triangles[i] * stride;
 		float x1 = vertices[vertexOffset], y1 = vertices[vertexOffset + 1];
 
@@ -109,8 +310,9 @@ continue_outer:
 		float x3 = vertices[vertexOffset], y3 = vertices[vertexOffset + 1];
 
 		for (size_t p = 0; p < polygonsCount; p++) {
+			if (classes[p] == Triangle_Outside) continue;
 			size_t s = clippedVertices.size();
-			if (clip(x1, y1, x2, y2, x3, y3, &(*polygons[p]), &clipOutput)) {
+			if (classes[p] == Triangle_Clipped && clip(x1, y1, x2, y2, x3, y3, &(*polygons[p]), &clipOutput)) {
 				size_t clipOutputLength = clipOutput.size();
 				if (clipOutputLength == 0) continue;
 
@@ -148,8 +350,7 @@ continue_outer:
 				clippedTriangles[s + 1] = (unsigned short) (index + 1);
 				clippedTriangles[s + 2] = (unsigned short) (index + 2);
 				index += 3;
-				i += 3;
-				goto continue_outer;
+				break;
 			}
 		}
 	}
@@ -173,9 +374,13 @@ void SkeletonClipping::clipTriangles(float *vertices, unsigned short *triangles,
 	_clippedUVs.clear();
 	clippedTriangles.clear();
 
-	size_t i = 0;
-continue_outer:
-	for (; i < trianglesLength; i += 3) {
+	classifyTriangles(vertices, triangles, trianglesLength, stride);
+	unsigned char *classes = _triangleClasses.buffer();
+	clippedVertices.ensureCapacity(trianglesLength << 1);
+	_clippedUVs.ensureCapacity(trianglesLength << 1);
+	clippedTriangles.ensureCapacity(trianglesLength);
+
+	for (size_t i = 0; i < trianglesLength; i += 3, classes += polygonsCount) {
 		int vertexOffset = triangles[i] * (int) stride;
 		float x1 = vertices[vertexOffset], y1 = vertices[vertexOffset + 1];
 		float u1 = uvs[vertexOffset], v1 = uvs[vertexOffset + 1];
@@ -189,8 +394,9 @@ continue_outer:
 		float u3 = uvs[vertexOffset], v3 = uvs[vertexOffset + 1];
 
 		for (size_t p = 0; p < polygonsCount; p++) {
+			if (classes[p] == Triangle_Outside) continue;
 			size_t s = clippedVertices.size();
-			if (clip(x1, y1, x2, y2, x3, y3, &(*polygons[p]), &clipOutput)) {
+			if (classes[p] == Triangle_Clipped && clip(x1, y1, x2, y2, x3, y3, &(*polygons[p]), &clipOutput)) {
 				size_t clipOutputLength = clipOutput.size();
 				if (clipOutputLength == 0) continue;
 				float d0 = y2 - y3, d1 = x3 - x2, d2 = x1 - x3, d4 = y3 - y1;
@@ -245,8 +451,7 @@ continue_outer:
 				clippedTriangles[s + 1] = (unsigned short) (index + 1);
 				clippedTriangles[s + 2] = (unsigned short) (index + 2);
 				index += 3;
-				i += 3;
-				goto continue_outer;
+				break;
 			}
 		}
 	}
@@ -256,6 +461,14 @@ bool SkeletonClipping::isClipping() {
 	return _clipAttachment != NULL;
 }
 
+void SkeletonClipping::setClassifyTriangles(bool classifyTriangles) {
+	_classifyTriangles = classifyTriangles;
+}
+
+bool SkeletonClipping::getClassifyTriangles() {
+	return _classifyTriangles;
+}
+
 Vector<float> &SkeletonClipping::getClippedVertices() {
 	return _clippedVertices;
 }
@@ -30,20 +30,74 @@
 #include <spine/SkeletonData.h>
 
 #include <spine/Animation.h>
+#include <spine/AttachmentTimeline.h>
 #include <spine/BoneData.h>
+#include <spine/CurveTimeline.h>
+#include <spine/DeformTimeline.h>
+#include <spine/DrawOrderTimeline.h>
+#include <spine/Event.h>
 #include <spine/EventData.h>
+#include <spine/EventTimeline.h>
 #include <spine/IkConstraintData.h>
+#include <spine/MathUtil.h>
 #include <spine/PathConstraintData.h>
 #include <spine/PhysicsConstraintData.h>
 #include <spine/Skin.h>
 #include <spine/SlotData.h>
 #include <spine/TransformConstraintData.h>
+#include <spine/UpdateCacheTemplate.h>
 
 #include <spine/ContainerUtil.h>
+#include <spine/SkeletonBinary.h>
+
+#ifndef SPINE_NO_THREADS
+#include <mutex>
+#endif
 
 using namespace spine;
 
-SkeletonData::SkeletonData() : _name(),
+#ifndef SPINE_NO_THREADS
+// Guards loading and unloading lazily read animations and their use counts.
+static std::mutex &getAnimationMutex() {
+	static std::mutex mutex;
+	return mutex;
+}
+
+// Guards the update cache templates, which skeletons on different threads may find and add.
+static std::mutex &getUpdateCacheMutex() {
+	static std::mutex mutex;
+	return mutex;
+}
+#endif
+
+// Approximates the memory used by timelines from the sizes of their frame data.
+static size_t getTimelinesMemory(Vector<Timeline *> &timelines) {
+	// Timeline objects with their vectors.
+	size_t memory = timelines.size() * 128;
+	for (size_t i = 0; i < timelines.size(); i++) {
+		Timeline *timeline = timelines[i];
+		memory += timeline->getFrames().size() * sizeof(float);
+		if (timeline->getRTTI().instanceOf(CurveTimeline::rtti))
+			memory += static_cast<CurveTimeline *>(timeline)->getCurves().size() * sizeof(float);
+		if (timeline->getRTTI().isExactly(DeformTimeline::rtti)) {
+			Vector<Vector<float> > &vertices = static_cast<DeformTimeline *>(timeline)->getVertices();
+			for (size_t ii = 0; ii < vertices.size(); ii++)
+				memory += vertices[ii].size() * sizeof(float);
+		} else if (timeline->getRTTI().isExactly(DrawOrderTimeline::rtti)) {
+			Vector<Vector<int> > &drawOrders = static_cast<DrawOrderTimeline *>(timeline)->getDrawOrders();
+			for (size_t ii = 0; ii < drawOrders.size(); ii++)
+				memory += drawOrders[ii].size() * sizeof(int);
+		} else if (timeline->getRTTI().isExactly(EventTimeline::rtti)) {
+			memory += static_cast<EventTimeline *>(timeline)->getEvents().size() * sizeof(Event);
+		} else if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti)) {
+			memory += static_cast<AttachmentTimeline *>(timeline)->getAttachmentNames().size() * (sizeof(String) + sizeof(int));
+		}
+	}
+	return memory;
+}
+
+SkeletonData::SkeletonData() : _arena(NULL),
+							   _name(),
 							   _defaultSkin(NULL),
 							   _x(0),
 							   _y(0),
@@ -52,11 +106,21 @@ SkeletonData::SkeletonData() : _name(),
 							   _referenceScale(100),
 							   _version(),
 							   _hash(),
+							   _attachmentIdsVersion(0),
+							   _animationReader(NULL),
+							   _animationMemory(0),
+							   _animationMemoryBudget(0),
+							   _animationUses(0),
+							   _quantizeTimelines(false),
+							   _quantizeValueTolerance(0),
+							   _quantizeTimeTolerance(0),
 							   _fps(0),
 							   _imagesPath() {
 }
 
 SkeletonData::~SkeletonData() {
+	if (_arena) _arenaScope.enter(_arena, true);
+
 	ContainerUtil::cleanUpVectorOfPointers(_bones);
 	ContainerUtil::cleanUpVectorOfPointers(_slots);
 	ContainerUtil::cleanUpVectorOfPointers(_skins);
@@ -69,45 +133,271 @@ SkeletonData::~SkeletonData() {
 	ContainerUtil::cleanUpVectorOfPointers(_transformConstraints);
 	ContainerUtil::cleanUpVectorOfPointers(_pathConstraints);
 	ContainerUtil::cleanUpVectorOfPointers(_physicsConstraints);
-	for (size_t i = 0; i < _strings.size(); i++) {
-		SpineExtension::free(_strings[i], __FILE__, __LINE__);
-	}
+	delete _animationReader;
+	ContainerUtil::cleanUpVectorOfPointers(_updateCacheTemplates);
 }
 
 BoneData *SkeletonData::findBone(const String &boneName) {
-	return ContainerUtil::findWithName(_bones, boneName);
+	int index = _boneIndex.find(_bones, boneName);
+	return index == -1 ? NULL : _bones[index];
 }
 
 SlotData *SkeletonData::findSlot(const String &slotName) {
-	return ContainerUtil::findWithName(_slots, slotName);
+	int index = _slotIndex.find(_slots, slotName);
+	return index == -1 ? NULL : _slots[index];
 }
 
 Skin *SkeletonData::findSkin(const String &skinName) {
-	return ContainerUtil::findWithName(_skins, skinName);
+	int index = _skinIndex.find(_skins, skinName);
+	return index == -1 ? NULL : _skins[index];
 }
 
 spine::EventData *SkeletonData::findEvent(const String &eventDataName) {
-	return ContainerUtil::findWithName(_events, eventDataName);
+	int index = _eventIndex.find(_events, eventDataName);
+	return index == -1 ? NULL : _events[index];
 }
 
 Animation *SkeletonData::findAnimation(const String &animationName) {
-	return ContainerUtil::findWithName(_animations, animationName);
+	int index = _animationIndex.find(_animations, animationName);
+	return index == -1 ? NULL : _animations[index];
 }
 
 IkConstraintData *SkeletonData::findIkConstraint(const String &constraintName) {
-	return ContainerUtil::findWithName(_ikConstraints, constraintName);
+	int index = _ikConstraintIndex.find(_ikConstraints, constraintName);
+	return index == -1 ? NULL : _ikConstraints[index];
 }
 
 TransformConstraintData *SkeletonData::findTransformConstraint(const String &constraintName) {
-	return ContainerUtil::findWithName(_transformConstraints, constraintName);
+	int index = _transformConstraintIndex.find(_transformConstraints, constraintName);
+	return index == -1 ? NULL : _transformConstraints[index];
 }
 
 PathConstraintData *SkeletonData::findPathConstraint(const String &constraintName) {
-	return ContainerUtil::findWithName(_pathConstraints, constraintName);
+	int index = _pathConstraintIndex.find(_pathConstraints, constraintName);
+	return index == -1 ? NULL : _pathConstraints[index];
 }
 
 PhysicsConstraintData *SkeletonData::findPhysicsConstraint(const String &constraintName) {
-	return ContainerUtil::findWithName(_physicsConstraints, constraintName);
+	int index = _physicsConstraintIndex.find(_physicsConstraints, constraintName);
+	return index == -1 ? NULL : _physicsConstraints[index];
+}
+
+void SkeletonData::updateNameIndex() {
+	ArenaScope arenaScope(_arena);
+	_boneIndex.build(_bones);
+	_slotIndex.build(_slots);
+	_skinIndex.build(_skins);
+	_eventIndex.build(_events);
+	_animationIndex.build(_animations);
+	_ikConstraintIndex.build(_ikConstraints);
+	_transformConstraintIndex.build(_transformConstraints);
+	_pathConstraintIndex.build(_pathConstraints);
+	_physicsConstraintIndex.build(_physicsConstraints);
+}
+
+void SkeletonData::updateAttachmentIds() {
+	ArenaScope arenaScope(_arena);
+	for (size_t i = 0; i < _slots.size(); i++) {
+		SlotData &slot = *_slots[i];
+		slot._attachmentKeys.clear();
+		slot._attachmentId = internAttachmentName(slot, slot._attachmentName);
+	}
+
+	for (size_t i = 0; i < _animations.size(); i++) {
+		Vector<Timeline *> &timelines = _animations[i]->getTimelines();
+		for (size_t ii = 0; ii < timelines.size(); ii++) {
+			if (!timelines[ii]->getRTTI().isExactly(AttachmentTimeline::rtti)) continue;
+			AttachmentTimeline *timeline = static_cast<AttachmentTimeline *>(timelines[ii]);
+			int slotIndex = timeline->_slotIndex;
+			bool valid = slotIndex >= 0 && slotIndex < (int) _slots.size();
+			for (size_t frame = 0; frame < timeline->_attachmentNames.size(); frame++)
+				timeline->_attachmentIds[frame] = valid ? internAttachmentName(*_slots[slotIndex], timeline->_attachmentNames[frame]) : -1;
+		}
+	}
+
+	// Skeletons rebuild their resolved attachments when the version changes.
+	_attachmentIdsVersion++;
+}
+
+int SkeletonData::internAttachmentName(SlotData &slot, const String &name) {
+	if (name.isEmpty()) return -1;
+	Vector<String> &keys = slot._attachmentKeys;
+	for (size_t i = 0; i < keys.size(); i++)
+		if (keys[i] == name) return (int) i;
+	keys.add(name);
+	return (int) keys.size() - 1;
+}
+
+int SkeletonData::findAttachmentId(SlotData &slot, const String &name) {
+	if (name.isEmpty()) return -1;
+	Vector<String> &keys = slot._attachmentKeys;
+	for (size_t i = 0; i < keys.size(); i++)
+		if (keys[i] == name) return (int) i;
+	return -1;
+}
+
+bool SkeletonData::loadAnimation(Animation *animation) {
+	if (!animation->_lazyData) return true;
+#ifndef SPINE_NO_THREADS
+	std::lock_guard<std::mutex> lock(getAnimationMutex());
+#endif
+	if (!loadLazyAnimation(animation)) return false;
+	animation->_useCount++;
+	return true;
+}
+
+void SkeletonData::releaseAnimation(Animation *animation) {
+	if (!animation->_lazyData) return;
+#ifndef SPINE_NO_THREADS
+	std::lock_guard<std::mutex> lock(getAnimationMutex());
+#endif
+	assert(animation->_useCount > 0);
+	animation->_useCount--;
+}
+
+void SkeletonData::unloadAnimation(Animation *animation) {
+	if (!animation->_lazyData) return;
+#ifndef SPINE_NO_THREADS
+	std::lock_guard<std::mutex> lock(getAnimationMutex());
+#endif
+	if (animation->_loaded && animation->_useCount == 0) unloadLazyAnimation(animation);
+}
+
+void SkeletonData::setAnimationMemoryBudget(size_t budget) {
+#ifndef SPINE_NO_THREADS
+	std::lock_guard<std::mutex> lock(getAnimationMutex());
+#endif
+	_animationMemoryBudget = budget;
+	unloadUnusedAnimations(NULL);
+}
+
+size_t SkeletonData::getAnimationMemoryBudget() {
+#ifndef SPINE_NO_THREADS
+	std::lock_guard<std::mutex> lock(getAnimationMutex());
+#endif
+	return _animationMemoryBudget;
+}
+
+size_t SkeletonData::getAnimationMemory() {
+#ifndef SPINE_NO_THREADS
+	std::lock_guard<std::mutex> lock(getAnimationMutex());
+#endif
+	return _animationMemory;
+}
+
+size_t SkeletonData::quantizeTimelines(float valueTolerance, float timeTolerance) {
+#ifndef SPINE_NO_THREADS
+	std::lock_guard<std::mutex> lock(getAnimationMutex());
+#endif
+	_quantizeTimelines = true;
+	_quantizeValueTolerance = valueTolerance;
+	_quantizeTimeTolerance = timeTolerance;
+	size_t saved = 0, tableMemory = _bezierTable.getMemory();
+	for (size_t i = 0; i < _animations.size(); i++) {
+		Animation *animation = _animations[i];
+		size_t animationSaved = quantizeAnimation(animation);
+		if (animation->_lazyData && animation->_loaded) {
+			animationSaved = MathUtil::min(animation->_memory, animationSaved);
+			animation->_memory -= animationSaved;
+			_animationMemory -= animationSaved;
+		}
+		saved += animationSaved;
+	}
+	tableMemory = _bezierTable.getMemory() - tableMemory;
+	return saved > tableMemory ? saved - tableMemory : 0;
+}
+
+size_t SkeletonData::getQuantizedMemorySaved() {
+#ifndef SPINE_NO_THREADS
+	std::lock_guard<std::mutex> lock(getAnimationMutex());
+#endif
+	size_t saved = 0;
+	for (size_t i = 0; i < _animations.size(); i++) {
+		Vector<Timeline *> &timelines = _animations[i]->_timelines;
+		for (size_t ii = 0; ii < timelines.size(); ii++) {
+			if (timelines[ii]->getRTTI().instanceOf(CurveTimeline::rtti))
+				saved += static_cast<CurveTimeline *>(timelines[ii])->getQuantizedMemorySaved();
+		}
+	}
+	size_t tableMemory = _bezierTable.getMemory();
+	return saved > tableMemory ? saved - tableMemory : 0;
+}
+
+bool SkeletonData::loadLazyAnimation(Animation *animation) {
+	animation->_lastUse = ++_animationUses;
+	if (animation->_loaded) return true;
+	if (!_animationReader->readLazyAnimation(animation, this)) return false;
+	animation->_loaded = true;
+	animation->_memory = getTimelinesMemory(animation->_timelines);
+	if (_quantizeTimelines) animation->_memory -= MathUtil::min(animation->_memory, quantizeAnimation(animation));
+	_animationMemory += animation->_memory;
+	unloadUnusedAnimations(animation);
+	return true;
+}
+
+// Limits the memory used by templates when many combinations of skin bones and constraints are used.
+static const size_t maxUpdateCacheTemplates = 64;
+
+UpdateCacheTemplate *SkeletonData::findUpdateCacheTemplate(Vector<int> &skinKey) {
+#ifndef SPINE_NO_THREADS
+	std::lock_guard<std::mutex> lock(getUpdateCacheMutex());
+#endif
+	for (size_t i = 0; i < _updateCacheTemplates.size(); i++)
+		if (_updateCacheTemplates[i]->_skinKey == skinKey) return _updateCacheTemplates[i];
+	return NULL;
+}
+
+void SkeletonData::addUpdateCacheTemplate(UpdateCacheTemplate *updateCacheTemplate) {
+#ifndef SPINE_NO_THREADS
+	std::lock_guard<std::mutex> lock(getUpdateCacheMutex());
+#endif
+	bool add = _updateCacheTemplates.size() < maxUpdateCacheTemplates;
+	for (size_t i = 0; add && i < _updateCacheTemplates.size(); i++)
+		if (_updateCacheTemplates[i]->_skinKey == updateCacheTemplate->_skinKey) add = false;
+	if (!add) {
+		delete updateCacheTemplate;
+		return;
+	}
+	// Templates live as long as the data, whatever arena is current on the calling thread.
+	ArenaScope arenaScope(NULL);
+	_updateCacheTemplates.add(updateCacheTemplate);
+}
+
+size_t SkeletonData::quantizeAnimation(Animation *animation) {
+	// Lazily read animations are not allocated from the arena, see SkeletonBinary::readLazyAnimation().
+	ArenaScope arenaScope(animation->_lazyData ? NULL : _arena);
+	size_t saved = 0;
+	Vector<Timeline *> &timelines = animation->_timelines;
+	for (size_t i = 0; i < timelines.size(); i++) {
+		if (timelines[i]->getRTTI().instanceOf(CurveTimeline::rtti))
+			saved += static_cast<CurveTimeline *>(timelines[i])->quantize(_quantizeValueTolerance, _quantizeTimeTolerance, _bezierTable);
+	}
+	return saved;
+}
+
+void SkeletonData::unloadLazyAnimation(Animation *animation) {
+	ContainerUtil::cleanUpVectorOfPointers(animation->_timelines);
+	animation->_timelineIds.clear();
+	animation->_loaded = false;
+	_animationMemory -= animation->_memory;
+	animation->_memory = 0;
+}
+
+void SkeletonData::unloadUnusedAnimations(Animation *keep) {
+	while (_animationMemoryBudget > 0 && _animationMemory > _animationMemoryBudget) {
+		Animation *oldest = NULL;
+		for (size_t i = 0; i < _animations.size(); i++) {
+			Animation *animation = _animations[i];
+			if (animation == keep || !animation->_lazyData || !animation->_loaded || animation->_useCount > 0) continue;
+			if (!oldest || animation->_lastUse < oldest->_lastUse) oldest = animation;
+		}
+		if (!oldest) break;
+		unloadLazyAnimation(oldest);
+	}
+}
+
+Arena *SkeletonData::getArena() {
+	return _arena;
 }
 
 const String &SkeletonData::getName() {
@@ -67,6 +67,8 @@
 #include <spine/ShearTimeline.h>
 #include <spine/Skin.h>
 #include <spine/SlotData.h>
+#include <spine/StringTable.h>
+#include <spine/TaskRunner.h>
 #include <spine/TransformConstraintData.h>
 #include <spine/TransformConstraintTimeline.h>
 #include <spine/TranslateTimeline.h>
@@ -76,6 +78,18 @@
 
 using namespace spine;
 
+struct SkeletonJson::AnimationTask {
+	SkeletonJson *loader;
+	SkeletonData *skeletonData;
+	Json *map;
+	Arena *arena;
+	Animation *animation;
+	String error;
+
+	AnimationTask() : loader(NULL), skeletonData(NULL), map(NULL), arena(NULL), animation(NULL) {
+	}
+};
+
 static float toColor(const char *value, size_t index) {
 	char digits[3];
 	char *error;
@@ -102,11 +116,16 @@ static void toColor(Color &color, const char *value, bool hasAlpha) {
 }
 
 SkeletonJson::SkeletonJson(Atlas *atlas) : _attachmentLoader(new (__FILE__, __LINE__) AtlasAttachmentLoader(atlas)),
-										   _scale(1), _ownsLoader(true) {}
+										   _scale(1), _bezierSamples(0), _useArena(false),
+										   _taskRunner(NULL), _ownsLoader(true), _atlasLoader(true) {}
 
 SkeletonJson::SkeletonJson(AttachmentLoader *attachmentLoader, bool ownsLoader) : _attachmentLoader(attachmentLoader),
 																				  _scale(1),
-																				  _ownsLoader(ownsLoader) {
+																				  _bezierSamples(0),
+																				  _useArena(false),
+																				  _taskRunner(NULL),
+																				  _ownsLoader(ownsLoader),
+																				  _atlasLoader(false) {
 	assert(_attachmentLoader != NULL);
 }
 
@@ -133,22 +152,35 @@ SkeletonData *SkeletonJson::readSkeletonDataFile(const String &path) {
 }
 
 SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
+	_error = "";
+	_linkedMeshes.clear();
+
+	// Everything allocated while loading goes into the arena. It is handed to the skeleton data if loading succeeds,
+	// otherwise the scope deletes it after the partially loaded data was deleted.
+	ArenaScope arenaScope(_useArena ? new (__FILE__, __LINE__) Arena() : NULL, true);
+	SkeletonData *skeletonData = parseSkeletonData(json);
+	if (skeletonData) skeletonData->_arena = arenaScope.release();
+	return skeletonData;
+}
+
+SkeletonData *SkeletonJson::parseSkeletonData(const char *json) {
 	int i, ii;
 	SkeletonData *skeletonData;
 	Json *root, *skeleton, *bones, *boneMap, *ik, *transform, *path, *physics, *slots, *skins, *animations, *events;
 
-	_error = "";
-	_linkedMeshes.clear();
+	{
+		// The JSON tree is deleted after loading and the skeleton data owns the arena, so neither is allocated from it.
+		ArenaScope arenaScope(NULL);
+		root = new (__FILE__, __LINE__) Json(json);
 
-	root = new (__FILE__, __LINE__) Json(json);
+		if (!root) {
+			setError(NULL, "Invalid skeleton JSON: ", Json::getError());
+			return NULL;
+		}
 
-	if (!root) {
-		setError(NULL, "Invalid skeleton JSON: ", Json::getError());
-		return NULL;
+		skeletonData = new (__FILE__, __LINE__) SkeletonData();
 	}
 
-	skeletonData = new (__FILE__, __LINE__) SkeletonData();
-
 	skeleton = Json::getItem(root, "skeleton");
 	if (skeleton) {
 		skeletonData->_hash = Json::getString(skeleton, "hash", 0);
@@ -188,7 +220,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 			}
 		}
 
-		data = new (__FILE__, __LINE__) BoneData(bonesCount, Json::getString(boneMap, "name", 0), parent);
+		data = new (__FILE__, __LINE__) BoneData(bonesCount, StringTable::intern(Json::getString(boneMap, "name", 0)), parent);
 
 		data->_length = Json::getFloat(boneMap, "length", 0) * _scale;
 		data->_x = Json::getFloat(boneMap, "x", 0) * _scale;
@@ -241,7 +273,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 				return NULL;
 			}
 
-			String slotName = String(Json::getString(slotMap, "name", 0));
+			String slotName = StringTable::intern(Json::getString(slotMap, "name", 0));
 			data = new (__FILE__, __LINE__) SlotData(i, slotName, *boneData);
 
 			color = Json::getString(slotMap, "color", 0);
@@ -264,7 +296,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 			}
 
 			item = Json::getItem(slotMap, "attachment");
-			if (item) data->setAttachmentName(item->_valueString);
+			if (item) data->setAttachmentName(StringTable::intern(item->_valueString));
 
 			item = Json::getItem(slotMap, "blend");
 			if (item) {
@@ -289,7 +321,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 			const char *targetName;
 
 			IkConstraintData *data = new (__FILE__, __LINE__) IkConstraintData(
-					Json::getString(constraintMap, "name", 0));
+					StringTable::intern(Json::getString(constraintMap, "name", 0)));
 			data->setOrder(Json::getInt(constraintMap, "order", 0));
 			data->setSkinRequired(Json::getBoolean(constraintMap, "skin", false));
 
@@ -334,7 +366,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 			const char *name;
 
 			TransformConstraintData *data = new (__FILE__, __LINE__) TransformConstraintData(
-					Json::getString(constraintMap, "name", 0));
+					StringTable::intern(Json::getString(constraintMap, "name", 0)));
 			data->setOrder(Json::getInt(constraintMap, "order", 0));
 			data->setSkinRequired(Json::getBoolean(constraintMap, "skin", false));
 
@@ -389,7 +421,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 			const char *item;
 
 			PathConstraintData *data = new (__FILE__, __LINE__) PathConstraintData(
-					Json::getString(constraintMap, "name", 0));
+					StringTable::intern(Json::getString(constraintMap, "name", 0)));
 			data->setOrder(Json::getInt(constraintMap, "order", 0));
 			data->setSkinRequired(Json::getBoolean(constraintMap, "skin", false));
 
@@ -460,7 +492,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 			const char *name;
 
 			PhysicsConstraintData *data = new (__FILE__, __LINE__) PhysicsConstraintData(
-					Json::getString(constraintMap, "name", 0));
+					StringTable::intern(Json::getString(constraintMap, "name", 0)));
 			data->setOrder(Json::getInt(constraintMap, "order", 0));
 			data->setSkinRequired(Json::getBoolean(constraintMap, "skin", false));
 
@@ -509,7 +541,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 			Json *attachmentsMap;
 			Json *curves;
 
-			Skin *skin = new (__FILE__, __LINE__) Skin(Json::getString(skinMap, "name", ""));
+			Skin *skin = new (__FILE__, __LINE__) Skin(StringTable::intern(Json::getString(skinMap, "name", "")));
 
 			Json *item = Json::getItem(skinMap, "bones");
 			if (item) {
@@ -590,9 +622,9 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 
 					for (attachmentMap = attachmentsMap->_child; attachmentMap; attachmentMap = attachmentMap->_next) {
 						Attachment *attachment = NULL;
-						const char *skinAttachmentName = attachmentMap->_name;
-						const char *attachmentName = Json::getString(attachmentMap, "name", skinAttachmentName);
-						const char *attachmentPath = Json::getString(attachmentMap, "path", attachmentName);
+						String skinAttachmentName = StringTable::intern(attachmentMap->_name);
+						String attachmentName = StringTable::intern(Json::getString(attachmentMap, "name", attachmentMap->_name));
+						String attachmentPath = StringTable::intern(Json::getString(attachmentMap, "path", attachmentName.buffer()));
 						const char *color;
 						Json *entry;
 
@@ -617,11 +649,17 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 							return NULL;
 						}
 
+						// A custom attachment loader may allocate memory it frees itself, which must not come from the
+						// data's arena.
+						ArenaScope loaderScope;
+						if (!_atlasLoader) loaderScope.enter(NULL);
+
 						switch (type) {
 							case AttachmentType_Region: {
 								Sequence *sequence = readSequence(Json::getItem(attachmentMap, "sequence"));
 								attachment = _attachmentLoader->newRegionAttachment(*skin, attachmentName, attachmentPath, sequence);
 								if (!attachment) {
+									loaderScope.exit();
 									delete skeletonData;
 									setError(root, "Error reading attachment: ", skinAttachmentName);
 									return NULL;
@@ -652,6 +690,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 								attachment = _attachmentLoader->newMeshAttachment(*skin, attachmentName, attachmentPath, sequence);
 
 								if (!attachment) {
+									loaderScope.exit();
 									delete skeletonData;
 									setError(root, "Error reading attachment: ", skinAttachmentName);
 									return NULL;
@@ -684,6 +723,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 										mesh->_regionUVs[ii] = entry->_valueFloat;
 
 									readVertices(attachmentMap, mesh, verticesLength);
+									mesh->updateBounds();
 
 									if (mesh->_region != NULL) mesh->updateRegion();
 
@@ -699,6 +739,8 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 									_attachmentLoader->configureAttachment(mesh);
 								} else {
 									bool inheritTimelines = Json::getInt(attachmentMap, "timelines", 1) ? true : false;
+									// Linked meshes are owned by the loader, so they are not allocated from the arena.
+									ArenaScope arenaScope(NULL);
 									LinkedMesh *linkedMesh = new (__FILE__, __LINE__) LinkedMesh(mesh,
 																								 String(Json::getString(
 																										 attachmentMap,
@@ -770,6 +812,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 								readVertices(attachmentMap, clip, vertexCount);
 								color = Json::getString(attachmentMap, "color", NULL);
 								if (color) toColor(clip->getColor(), color, true);
+								clip->updateConvexPolygons();
 								_attachmentLoader->configureAttachment(attachment);
 								break;
 							}
@@ -801,6 +844,8 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 																			  : linkedMesh->_mesh;
 		linkedMesh->_mesh->setParentMesh(static_cast<MeshAttachment *>(parent));
 		if (linkedMesh->_mesh->_region != NULL) linkedMesh->_mesh->updateRegion();
+		ArenaScope loaderScope;
+		if (!_atlasLoader) loaderScope.enter(NULL);
 		_attachmentLoader->configureAttachment(linkedMesh->_mesh);
 	}
 	ContainerUtil::cleanUpVectorOfPointers(_linkedMeshes);
@@ -813,12 +858,12 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 		skeletonData->_events.ensureCapacity(events->_size);
 		skeletonData->_events.setSize(events->_size, 0);
 		for (eventMap = events->_child, i = 0; eventMap; eventMap = eventMap->_next, ++i) {
-			EventData *eventData = new (__FILE__, __LINE__) EventData(String(eventMap->_name));
+			EventData *eventData = new (__FILE__, __LINE__) EventData(StringTable::intern(eventMap->_name));
 
 			eventData->_intValue = Json::getInt(eventMap, "int", 0);
 			eventData->_floatValue = Json::getFloat(eventMap, "float", 0);
 			const char *stringValue = Json::getString(eventMap, "string", 0);
-			eventData->_stringValue = stringValue;
+			eventData->_stringValue = StringTable::intern(stringValue);
 			const char *audioPath = Json::getString(eventMap, "audio", 0);
 			eventData->_audioPath = audioPath;
 			if (audioPath) {
@@ -829,26 +874,38 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 		}
 	}
 
+	skeletonData->updateNameIndex();
+
 	/* Animations. */
 	animations = Json::getItem(root, "animations");
 	if (animations) {
 		Json *animationMap;
 		skeletonData->_animations.ensureCapacity(animations->_size);
 		skeletonData->_animations.setSize(animations->_size, 0);
-		int animationsIndex = 0;
-		for (animationMap = animations->_child; animationMap; animationMap = animationMap->_next) {
-			Animation *animation = readAnimation(animationMap, skeletonData);
-			if (!animation) {
+		if (_taskRunner) {
+			if (!readAnimations(animations, skeletonData)) {
 				delete skeletonData;
 				delete root;
 				return NULL;
 			}
-			skeletonData->_animations[animationsIndex++] = animation;
+		} else {
+			int animationsIndex = 0;
+			for (animationMap = animations->_child; animationMap; animationMap = animationMap->_next) {
+				Animation *animation = readAnimation(animationMap, skeletonData);
+				if (!animation) {
+					delete skeletonData;
+					delete root;
+					return NULL;
+				}
+				skeletonData->_animations[animationsIndex++] = animation;
+			}
 		}
 	}
 
 	delete root;
 
+	skeletonData->updateNameIndex();
+	skeletonData->updateAttachmentIds();
 	return skeletonData;
 }
 
@@ -934,7 +991,7 @@ Timeline *SkeletonJson::readTimeline(Json *keyMap, CurveTimeline2 *timeline, con
 }
 
 int SkeletonJson::findSlotIndex(SkeletonData *skeletonData, const String &slotName, Vector<Timeline *> timelines) {
-	int slotIndex = ContainerUtil::findIndexWithName(skeletonData->getSlots(), slotName);
+	int slotIndex = skeletonData->_slotIndex.find(skeletonData->_slots, slotName);
 	if (slotIndex == -1) {
 		ContainerUtil::cleanUpVectorOfPointers(timelines);
 		setError(NULL, "Slot not found: ", slotName);
@@ -967,8 +1024,9 @@ Animation *SkeletonJson::readAnimation(Json *root, SkeletonData *skeletonData) {
 			if (strcmp(timelineMap->_name, "attachment") == 0) {
 				AttachmentTimeline *timeline = new (__FILE__, __LINE__) AttachmentTimeline(frames, slotIndex);
 				for (keyMap = timelineMap->_child, frame = 0; keyMap; keyMap = keyMap->_next, ++frame) {
+					Json *name = Json::getItem(keyMap, "name");
 					timeline->setFrame(frame, Json::getFloat(keyMap, "time", 0),
-									   Json::getItem(keyMap, "name") ? Json::getItem(keyMap, "name")->_valueString : NULL);
+									   StringTable::intern(name ? name->_valueString : NULL));
 				}
 				timelines.add(timeline);
 
@@ -1104,7 +1162,7 @@ Animation *SkeletonJson::readAnimation(Json *root, SkeletonData *skeletonData) {
 
 	/** Bone timelines. */
 	for (boneMap = bones ? bones->_child : 0; boneMap; boneMap = boneMap->_next) {
-		int boneIndex = ContainerUtil::findIndexWithName(skeletonData->_bones, boneMap->_name);
+		int boneIndex = skeletonData->_boneIndex.find(skeletonData->_bones, boneMap->_name);
 		if (boneIndex == -1) {
 			ContainerUtil::cleanUpVectorOfPointers(timelines);
 			setError(NULL, "Bone not found: ", boneMap->_name);
@@ -1550,7 +1608,8 @@ Animation *SkeletonJson::readAnimation(Json *root, SkeletonData *skeletonData) {
 			event = new (__FILE__, __LINE__) Event(Json::getFloat(keyMap, "time", 0), *eventData);
 			event->_intValue = Json::getInt(keyMap, "int", eventData->_intValue);
 			event->_floatValue = Json::getFloat(keyMap, "float", eventData->_floatValue);
-			event->_stringValue = Json::getString(keyMap, "string", eventData->_stringValue.buffer());
+			const char *stringValue = Json::getString(keyMap, "string", NULL);
+			event->_stringValue = stringValue ? StringTable::intern(stringValue) : eventData->_stringValue;
 			if (!eventData->_audioPath.isEmpty()) {
 				event->_volume = Json::getFloat(keyMap, "volume", 1);
 				event->_balance = Json::getFloat(keyMap, "balance", 0);
@@ -1560,10 +1619,63 @@ Animation *SkeletonJson::readAnimation(Json *root, SkeletonData *skeletonData) {
 		timelines.add(timeline);
 	}
 
+	if (_bezierSamples > 0) {
+		for (size_t i = 0; i < timelines.size(); i++) {
+			if (timelines[i]->getRTTI().instanceOf(CurveTimeline::rtti))
+				static_cast<CurveTimeline *>(timelines[i])->bakeBeziers(_bezierSamples);
+		}
+	}
+
 	float duration = 0;
 	for (size_t i = 0; i < timelines.size(); i++)
 		duration = MathUtil::max(duration, timelines[i]->getDuration());
-	return new (__FILE__, __LINE__) Animation(String(root->_name), timelines, duration);
+	return new (__FILE__, __LINE__) Animation(StringTable::intern(root->_name), timelines, duration);
+}
+
+// Reads the animations as tasks. Returns false if reading one of them failed.
+bool SkeletonJson::readAnimations(Json *animations, SkeletonData *skeletonData) {
+	// Each task allocates from its own arena, merged into the skeleton data's arena afterward.
+	Arena *arena = Arena::getCurrent();
+	ArenaScope arenaScope(NULL);
+	Vector<AnimationTask> tasks;
+	tasks.setSize(animations->_size, AnimationTask());
+	int count = 0;
+	for (Json *animationMap = animations->_child; animationMap; animationMap = animationMap->_next, count++) {
+		AnimationTask &task = tasks[count];
+		task.loader = this;
+		task.skeletonData = skeletonData;
+		task.map = animationMap;
+		if (arena) task.arena = new (__FILE__, __LINE__) Arena(16 * 1024);
+	}
+
+	_taskRunner->run(count, readAnimationTask, tasks.buffer());
+
+	int failed = -1;
+	for (int i = 0; i < count; i++) {
+		AnimationTask &task = tasks[i];
+		if (task.arena) arena->merge(task.arena);
+		skeletonData->_animations[i] = task.animation;
+		if (!task.animation && failed == -1) failed = i;
+	}
+	if (failed != -1) {
+		_error = tasks[failed].error;
+		return false;
+	}
+	return true;
+}
+
+void SkeletonJson::readAnimationTask(void *context, size_t index) {
+	AnimationTask &task = ((AnimationTask *) context)[index];
+	ArenaScope arenaScope(task.arena);
+	// A loader per task, so errors are not set on the shared loader concurrently.
+	SkeletonJson loader(task.loader->_attachmentLoader);
+	loader._scale = task.loader->_scale;
+	loader._bezierSamples = task.loader->_bezierSamples;
+	task.animation = loader.readAnimation(task.map, task.skeletonData);
+	if (!task.animation) {
+		ArenaScope errorScope(NULL);
+		task.error = loader._error;
+	}
 }
 
 void SkeletonJson::readVertices(Json *attachmentMap, VertexAttachment *attachment, size_t verticesLength) {
@@ -1610,6 +1722,7 @@ void SkeletonJson::readVertices(Json *attachmentMap, VertexAttachment *attachmen
 }
 
 void SkeletonJson::setError(Json *root, const String &value1, const String &value2) {
+	ArenaScope arenaScope(NULL);
 	_error = String(value1).append(value2);
 	delete root;
 }
@@ -0,0 +1,74 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/SkeletonPool.h>
+
+#include <spine/ContainerUtil.h>
+#include <spine/Skeleton.h>
+
+using namespace spine;
+
+SkeletonPool::SkeletonPool(SkeletonData *skeletonData) : _skeletonData(skeletonData) {
+	assert(skeletonData != NULL);
+}
+
+SkeletonPool::~SkeletonPool() {
+	clear();
+}
+
+Skeleton *SkeletonPool::obtain() {
+	if (_free.size() == 0) return new (__FILE__, __LINE__) Skeleton(_skeletonData);
+	Skeleton *skeleton = _free[_free.size() - 1];
+	_free.removeAt(_free.size() - 1);
+	skeleton->reset();
+	return skeleton;
+}
+
+void SkeletonPool::free(Skeleton *skeleton) {
+	assert(skeleton->getData() == _skeletonData);
+	_free.add(skeleton);
+}
+
+void SkeletonPool::fill(size_t count) {
+	_free.ensureCapacity(count);
+	while (_free.size() < count)
+		_free.add(new (__FILE__, __LINE__) Skeleton(_skeletonData));
+}
+
+void SkeletonPool::clear() {
+	ContainerUtil::cleanUpVectorOfPointers(_free);
+}
+
+size_t SkeletonPool::getFree() {
+	return _free.size();
+}
+
+SkeletonData *SkeletonPool::getSkeletonData() {
+	return _skeletonData;
+}
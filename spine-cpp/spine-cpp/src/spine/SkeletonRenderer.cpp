@@ -35,6 +35,7 @@
 #include <spine/MeshAttachment.h>
 #include <spine/ClippingAttachment.h>
 #include <spine/Bone.h>
+#include <spine/Sequence.h>
 
 using namespace spine;
 
@@ -50,6 +51,13 @@ SkeletonRenderer::SkeletonRenderer() : _allocator(4096), _worldVertices(), _quad
 SkeletonRenderer::~SkeletonRenderer() {
 }
 
+RenderStream::RenderStream() : vertices(NULL), maxVertices(0), indices(NULL), maxIndices(0) {
+	memset(&layout, 0, sizeof(VertexLayout));
+}
+
+RenderStream::~RenderStream() {
+}
+
 static RenderCommand *createRenderCommand(BlockAllocator &allocator, int numVertices, int32_t numIndices, BlendMode blendMode, void *texture) {
 	RenderCommand *cmd = allocator.allocate<RenderCommand>(1);
 	cmd->positions = allocator.allocate<float>(numVertices << 1);
@@ -136,92 +144,127 @@ static RenderCommand *batchCommands(BlockAllocator &allocator, Vector<RenderComm
 	return root;
 }
 
-RenderCommand *SkeletonRenderer::render(Skeleton &skeleton) {
-	_allocator.compress();
-	_renderCommands.clear();
+namespace {
+	// The geometry of the attachment of a slot to render.
+	struct SlotGeometry {
+		Attachment *attachment;
+		bool region;
+		int32_t numVertices;
+		Vector<float> *uvs;
+		Vector<unsigned short> *indices;
+		uint32_t color;
+		uint32_t darkColor;
+		void *texture;
+	};
+}
 
-	SkeletonClipping &clipper = _clipping;
+// Returns false if the slot renders nothing, after starting or ending clipping for it as needed.
+static bool getSlotGeometry(Skeleton &skeleton, Slot &slot, SkeletonClipping &clipper, Vector<unsigned short> &quadIndices,
+							SlotGeometry &geometry) {
+	Attachment *attachment = slot.getAttachment();
+	if (!attachment) {
+		clipper.clipEnd(slot);
+		return false;
+	}
 
-	for (unsigned i = 0; i < skeleton.getSlots().size(); ++i) {
-		Slot &slot = *skeleton.getDrawOrder()[i];
-		Attachment *attachment = slot.getAttachment();
-		if (!attachment) {
+	// Early out if the slot color is 0 or the bone is not active
+	if (slot.getColor().a == 0 || !slot.getBone().isActive()) {
+		clipper.clipEnd(slot);
+		return false;
+	}
+
+	Color *attachmentColor;
+	geometry.attachment = attachment;
+	if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+		RegionAttachment *regionAttachment = (RegionAttachment *) attachment;
+		attachmentColor = &regionAttachment->getColor();
+
+		// Early out if the slot color is 0
+		if (attachmentColor->a == 0) {
 			clipper.clipEnd(slot);
-			continue;
+			return false;
 		}
 
-		// Early out if the slot color is 0 or the bone is not active
-		if (slot.getColor().a == 0 || !slot.getBone().isActive()) {
+		// The sequence sets the region the texture is taken from, computing the world vertices applies it again.
+		if (regionAttachment->getSequence()) regionAttachment->getSequence()->apply(&slot, regionAttachment);
+		geometry.region = true;
+		geometry.numVertices = 4;
+		geometry.uvs = &regionAttachment->getUVs();
+		geometry.indices = &quadIndices;
+		geometry.texture = regionAttachment->getRegion()->rendererObject;
+
+	} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+		MeshAttachment *mesh = (MeshAttachment *) attachment;
+		attachmentColor = &mesh->getColor();
+
+		// Early out if the slot color is 0
+		if (attachmentColor->a == 0) {
 			clipper.clipEnd(slot);
-			continue;
+			return false;
 		}
 
-		Vector<float> *worldVertices = &_worldVertices;
-		Vector<unsigned short> *quadIndices = &_quadIndices;
-		Vector<float> *vertices = worldVertices;
-		int32_t verticesCount;
-		Vector<float> *uvs;
-		Vector<unsigned short> *indices;
-		int32_t indicesCount;
-		Color *attachmentColor;
-		void *texture;
+		if (mesh->getSequence()) mesh->getSequence()->apply(&slot, mesh);
+		geometry.region = false;
+		geometry.numVertices = (int32_t) (mesh->getWorldVerticesLength() >> 1);
+		geometry.uvs = &mesh->getUVs();
+		geometry.indices = &mesh->getTriangles();
+		geometry.texture = mesh->getRegion()->rendererObject;
 
-		if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
-			RegionAttachment *regionAttachment = (RegionAttachment *) attachment;
-			attachmentColor = &regionAttachment->getColor();
+	} else if (attachment->getRTTI().isExactly(ClippingAttachment::rtti)) {
+		ClippingAttachment *clip = (ClippingAttachment *) slot.getAttachment();
+		clipper.clipStart(slot, clip);
+		return false;
+	} else
+		return false;
 
-			// Early out if the slot color is 0
-			if (attachmentColor->a == 0) {
-				clipper.clipEnd(slot);
-				continue;
-			}
+	uint8_t r = static_cast<uint8_t>(skeleton.getColor().r * slot.getColor().r * attachmentColor->r * 255);
+	uint8_t g = static_cast<uint8_t>(skeleton.getColor().g * slot.getColor().g * attachmentColor->g * 255);
+	uint8_t b = static_cast<uint8_t>(skeleton.getColor().b * slot.getColor().b * attachmentColor->b * 255);
+	uint8_t a = static_cast<uint8_t>(skeleton.getColor().a * slot.getColor().a * attachmentColor->a * 255);
+	geometry.color = (a << 24) | (r << 16) | (g << 8) | b;
+	geometry.darkColor = 0xff000000;
+	if (slot.hasDarkColor()) {
+		Color &slotDarkColor = slot.getDarkColor();
+		geometry.darkColor = 0xff000000 | (static_cast<uint8_t>(slotDarkColor.r * 255) << 16) | (static_cast<uint8_t>(slotDarkColor.g * 255) << 8) | static_cast<uint8_t>(slotDarkColor.b * 255);
+	}
+	return true;
+}
 
-			worldVertices->setSize(8, 0);
-			regionAttachment->computeWorldVertices(slot, *worldVertices, 0, 2);
-			verticesCount = 4;
-			uvs = &regionAttachment->getUVs();
-			indices = quadIndices;
-			indicesCount = 6;
-			texture = regionAttachment->getRegion()->rendererObject;
-
-		} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
-			MeshAttachment *mesh = (MeshAttachment *) attachment;
-			attachmentColor = &mesh->getColor();
-
-			// Early out if the slot color is 0
-			if (attachmentColor->a == 0) {
-				clipper.clipEnd(slot);
-				continue;
-			}
+// Offset and stride are in floats.
+static void computeWorldVertices(Slot &slot, SlotGeometry &geometry, float *worldVertices, size_t offset, size_t stride) {
+	if (geometry.region) {
+		((RegionAttachment *) geometry.attachment)->computeWorldVertices(slot, worldVertices, offset, stride);
+	} else {
+		MeshAttachment *mesh = (MeshAttachment *) geometry.attachment;
+		mesh->computeWorldVertices(slot, 0, mesh->getWorldVerticesLength(), worldVertices, offset, stride);
+	}
+}
 
-			worldVertices->setSize(mesh->getWorldVerticesLength(), 0);
-			mesh->computeWorldVertices(slot, 0, mesh->getWorldVerticesLength(), worldVertices->buffer(), 0, 2);
-			verticesCount = (int32_t) (mesh->getWorldVerticesLength() >> 1);
-			uvs = &mesh->getUVs();
-			indices = &mesh->getTriangles();
-			indicesCount = (int32_t) indices->size();
-			texture = mesh->getRegion()->rendererObject;
-
-		} else if (attachment->getRTTI().isExactly(ClippingAttachment::rtti)) {
-			ClippingAttachment *clip = (ClippingAttachment *) slot.getAttachment();
-			clipper.clipStart(slot, clip);
-			continue;
-		} else
-			continue;
+static inline uint32_t swapRedBlue(uint32_t color) {
+	return (color & 0xFF00FF00) | ((color & 0x00FF0000) >> 16) | ((color & 0x000000FF) << 16);
+}
 
-		uint8_t r = static_cast<uint8_t>(skeleton.getColor().r * slot.getColor().r * attachmentColor->r * 255);
-		uint8_t g = static_cast<uint8_t>(skeleton.getColor().g * slot.getColor().g * attachmentColor->g * 255);
-		uint8_t b = static_cast<uint8_t>(skeleton.getColor().b * slot.getColor().b * attachmentColor->b * 255);
-		uint8_t a = static_cast<uint8_t>(skeleton.getColor().a * slot.getColor().a * attachmentColor->a * 255);
-		uint32_t color = (a << 24) | (r << 16) | (g << 8) | b;
-		uint32_t darkColor = 0xff000000;
-		if (slot.hasDarkColor()) {
-			Color &slotDarkColor = slot.getDarkColor();
-			darkColor = 0xff000000 | (static_cast<uint8_t>(slotDarkColor.r * 255) << 16) | (static_cast<uint8_t>(slotDarkColor.g * 255) << 8) | static_cast<uint8_t>(slotDarkColor.b * 255);
-		}
+RenderCommand *SkeletonRenderer::render(Skeleton &skeleton) {
+	_allocator.compress();
+	_renderCommands.clear();
+
+	SkeletonClipping &clipper = _clipping;
+
+	for (unsigned i = 0; i < skeleton.getSlots().size(); ++i) {
+		Slot &slot = *skeleton.getDrawOrder()[i];
+		SlotGeometry geometry;
+		if (!getSlotGeometry(skeleton, slot, clipper, _quadIndices, geometry)) continue;
+
+		Vector<float> *vertices = &_worldVertices;
+		int32_t verticesCount = geometry.numVertices;
+		Vector<float> *uvs = geometry.uvs;
+		Vector<unsigned short> *indices = geometry.indices;
+		int32_t indicesCount = (int32_t) indices->size();
+		_worldVertices.setSize(verticesCount << 1, 0);
+		computeWorldVertices(slot, geometry, _worldVertices.buffer(), 0, 2);
 
 		if (clipper.isClipping()) {
-			clipper.clipTriangles(*worldVertices, *indices, *uvs, 2);
+			clipper.clipTriangles(_worldVertices, *indices, *uvs, 2);
 			vertices = &clipper.getClippedVertices();
 			verticesCount = (int32_t) (clipper.getClippedVertices().size() >> 1);
 			uvs = &clipper.getClippedUVs();
@@ -229,13 +272,13 @@ RenderCommand *SkeletonRenderer::render(Skeleton &skeleton) {
 			indicesCount = (int32_t) (clipper.getClippedTriangles().size());
 		}
 
-		RenderCommand *cmd = createRenderCommand(_allocator, verticesCount, indicesCount, slot.getData().getBlendMode(), texture);
+		RenderCommand *cmd = createRenderCommand(_allocator, verticesCount, indicesCount, slot.getData().getBlendMode(), geometry.texture);
 		_renderCommands.add(cmd);
 		memcpy(cmd->positions, vertices->buffer(), (verticesCount << 1) * sizeof(float));
 		memcpy(cmd->uvs, uvs->buffer(), (verticesCount << 1) * sizeof(float));
 		for (int ii = 0; ii < verticesCount; ii++) {
-			cmd->colors[ii] = color;
-			cmd->darkColors[ii] = darkColor;
+			cmd->colors[ii] = geometry.color;
+			cmd->darkColors[ii] = geometry.darkColor;
 		}
 		memcpy(cmd->indices, indices->buffer(), indices->size() * sizeof(uint16_t));
 		clipper.clipEnd(slot);
@@ -243,4 +286,122 @@ RenderCommand *SkeletonRenderer::render(Skeleton &skeleton) {
 	clipper.clipEnd();
 
 	return batchCommands(_allocator, _renderCommands);
-}
\ No newline at end of file
+}
+
+bool SkeletonRenderer::render(Skeleton &skeleton, RenderStream &stream) {
+	SkeletonClipping &clipper = _clipping;
+	const VertexLayout &layout = stream.layout;
+	// Unclipped positions are computed straight into the stream if its layout allows float access.
+	bool directPositions = layout.positionOffset >= 0 && (layout.stride & 3) == 0 && (layout.positionOffset & 3) == 0;
+	bool completed = true;
+	int32_t usedVertices = 0, usedIndices = 0;
+	RenderBatch batch;
+	batch.numVertices = 0;
+
+	for (unsigned i = 0; i < skeleton.getSlots().size(); ++i) {
+		Slot &slot = *skeleton.getDrawOrder()[i];
+		SlotGeometry geometry;
+		if (!getSlotGeometry(skeleton, slot, clipper, _quadIndices, geometry)) continue;
+
+		int32_t numVertices = geometry.numVertices;
+		Vector<float> *uvs = geometry.uvs;
+		Vector<unsigned short> *indices = geometry.indices;
+		float *positions = NULL;
+		bool clipped = clipper.isClipping();
+		if (clipped) {
+			_worldVertices.setSize(numVertices << 1, 0);
+			computeWorldVertices(slot, geometry, _worldVertices.buffer(), 0, 2);
+			clipper.clipTriangles(_worldVertices, *indices, *uvs, 2);
+			positions = clipper.getClippedVertices().buffer();
+			numVertices = (int32_t) (clipper.getClippedVertices().size() >> 1);
+			uvs = &clipper.getClippedUVs();
+			indices = &clipper.getClippedTriangles();
+		}
+		int32_t numIndices = (int32_t) indices->size();
+		if (numVertices == 0 || numIndices == 0) {
+			clipper.clipEnd(slot);
+			continue;
+		}
+		BlendMode blendMode = slot.getData().getBlendMode();
+
+		if (batch.numVertices > 0 &&
+			(geometry.texture != batch.texture || blendMode != batch.blendMode ||
+			 (layout.colorOffset < 0 && geometry.color != batch.color) ||
+			 (layout.darkColorOffset < 0 && geometry.darkColor != batch.darkColor) ||
+			 batch.numVertices + numVertices > 0xffff)) {
+			stream.batch(batch);
+			batch.numVertices = 0;
+		}
+		if (usedVertices + numVertices > stream.maxVertices || usedIndices + numIndices > stream.maxIndices) {
+			if (batch.numVertices > 0) {
+				stream.batch(batch);
+				batch.numVertices = 0;
+			}
+			if (!stream.flush() || numVertices > stream.maxVertices || numIndices > stream.maxIndices) {
+				completed = false;
+				break;
+			}
+			usedVertices = 0;
+			usedIndices = 0;
+		}
+		if (batch.numVertices == 0) {
+			batch.firstVertex = usedVertices;
+			batch.firstIndex = usedIndices;
+			batch.numIndices = 0;
+			batch.blendMode = blendMode;
+			batch.texture = geometry.texture;
+			batch.color = geometry.color;
+			batch.darkColor = geometry.darkColor;
+		}
+
+		uint8_t *vertex = (uint8_t *) stream.vertices + (size_t) usedVertices * layout.stride;
+		if (layout.positionOffset >= 0) {
+			if (!clipped && directPositions) {
+				computeWorldVertices(slot, geometry, (float *) (vertex + layout.positionOffset), 0, layout.stride >> 2);
+			} else {
+				if (!clipped) {
+					_worldVertices.setSize(numVertices << 1, 0);
+					computeWorldVertices(slot, geometry, _worldVertices.buffer(), 0, 2);
+					positions = _worldVertices.buffer();
+				}
+				uint8_t *position = vertex + layout.positionOffset;
+				for (int32_t ii = 0; ii < numVertices; ii++, position += layout.stride)
+					memcpy(position, positions + (ii << 1), sizeof(float) * 2);
+			}
+		}
+		if (layout.uvOffset >= 0) {
+			float *uvBuffer = uvs->buffer();
+			uint8_t *uv = vertex + layout.uvOffset;
+			for (int32_t ii = 0; ii < numVertices; ii++, uv += layout.stride)
+				memcpy(uv, uvBuffer + (ii << 1), sizeof(float) * 2);
+		}
+		if (layout.colorOffset >= 0) {
+			uint32_t color = layout.swapRedBlue ? swapRedBlue(geometry.color) : geometry.color;
+			uint8_t *target = vertex + layout.colorOffset;
+			for (int32_t ii = 0; ii < numVertices; ii++, target += layout.stride)
+				memcpy(target, &color, sizeof(uint32_t));
+		}
+		if (layout.darkColorOffset >= 0) {
+			uint32_t darkColor = layout.swapRedBlue ? swapRedBlue(geometry.darkColor) : geometry.darkColor;
+			uint8_t *target = vertex + layout.darkColorOffset;
+			for (int32_t ii = 0; ii < numVertices; ii++, target += layout.stride)
+				memcpy(target, &darkColor, sizeof(uint32_t));
+		}
+
+		unsigned short *indexBuffer = indices->buffer();
+		uint16_t *target = stream.indices + usedIndices;
+		uint16_t indexOffset = (uint16_t) batch.numVertices;
+		for (int32_t ii = 0; ii < numIndices; ii++)
+			target[ii] = indexBuffer[ii] + indexOffset;
+
+		batch.numVertices += numVertices;
+		batch.numIndices += numIndices;
+		usedVertices += numVertices;
+		usedIndices += numIndices;
+		clipper.clipEnd(slot);
+	}
+	if (batch.numVertices > 0) stream.batch(batch);
+	clipper.clipEnd();
+
+	return completed;
+}
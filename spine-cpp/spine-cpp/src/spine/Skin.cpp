@@ -59,10 +59,29 @@ void Skin::AttachmentMap::put(size_t slotIndex, const String &attachmentName, At
 		disposeAttachment(bucket[existing]._attachment);
 		bucket[existing]._attachment = attachment;
 	} else {
+		// Not interned here, so names created at runtime don't grow the process wide table.
 		bucket.add(Entry(slotIndex, attachmentName, attachment));
 	}
 }
 
+void Skin::AttachmentMap::putAll(size_t slotIndex, Vector<Entry> &entries) {
+	if (entries.size() == 0) return;
+	if (slotIndex >= _buckets.size())
+		_buckets.setSize(slotIndex + 1, Vector<Entry>());
+	Vector<Entry> &bucket = _buckets[slotIndex];
+	if (bucket.size() > 0) {
+		for (size_t i = 0, n = entries.size(); i < n; i++)
+			put(slotIndex, entries[i]._name, entries[i]._attachment);
+		return;
+	}
+	// The names are unique, so the bucket is copied without looking them up.
+	bucket.ensureCapacity(entries.size());
+	for (size_t i = 0, n = entries.size(); i < n; i++) {
+		entries[i]._attachment->reference();
+		bucket.add(entries[i]);
+	}
+}
+
 Attachment *Skin::AttachmentMap::get(size_t slotIndex, const String &attachmentName) {
 	if (slotIndex >= _buckets.size()) return NULL;
 	int existing = findInBucket(_buckets[slotIndex], attachmentName);
@@ -88,7 +107,8 @@ Skin::AttachmentMap::Entries Skin::AttachmentMap::getEntries() {
 	return Skin::AttachmentMap::Entries(_buckets);
 }
 
-Skin::Skin(const String &name) : _name(name), _attachments(), _color(0.99607843f, 0.61960787f, 0.30980393f, 1) {
+Skin::Skin(const String &name) : _name(name), _attachments(), _color(0.99607843f, 0.61960787f, 0.30980393f, 1),
+								 _version(0) {
 	assert(_name.length() > 0);
 }
 
@@ -103,6 +123,7 @@ Skin::~Skin() {
 void Skin::setAttachment(size_t slotIndex, const String &name, Attachment *attachment) {
 	assert(attachment);
 	_attachments.put(slotIndex, name, attachment);
+	_version++;
 }
 
 Attachment *Skin::getAttachment(size_t slotIndex, const String &name) {
@@ -111,6 +132,7 @@ Attachment *Skin::getAttachment(size_t slotIndex, const String &name) {
 
 void Skin::removeAttachment(size_t slotIndex, const String &name) {
 	_attachments.remove(slotIndex, name);
+	_version++;
 }
 
 void Skin::findNamesForSlot(size_t slotIndex, Vector<String> &names) {
@@ -141,15 +163,17 @@ Skin::AttachmentMap::Entries Skin::getAttachments() {
 
 void Skin::attachAll(Skeleton &skeleton, Skin &oldSkin) {
 	Vector<Slot *> &slots = skeleton.getSlots();
-	Skin::AttachmentMap::Entries entries = oldSkin.getAttachments();
-	while (entries.hasNext()) {
-		Skin::AttachmentMap::Entry &entry = entries.next();
-		int slotIndex = (int) entry._slotIndex;
+	Vector<Vector<AttachmentMap::Entry>> &buckets = oldSkin._attachments._buckets;
+	for (size_t slotIndex = 0, n = buckets.size(); slotIndex < n; slotIndex++) {
 		Slot *slot = slots[slotIndex];
-
-		if (slot->getAttachment() == entry._attachment) {
-			Attachment *attachment = getAttachment(slotIndex, entry._name);
-			if (attachment) slot->setAttachment(attachment);
+		if (!slot->getAttachment()) continue;
+		Vector<AttachmentMap::Entry> &bucket = buckets[slotIndex];
+		for (size_t i = 0, nn = bucket.size(); i < nn; i++) {
+			AttachmentMap::Entry &entry = bucket[i];
+			if (slot->getAttachment() == entry._attachment) {
+				Attachment *attachment = getAttachment(slotIndex, entry._name);
+				if (attachment) slot->setAttachment(attachment);
+			}
 		}
 	}
 }
@@ -161,11 +185,12 @@ void Skin::addSkin(Skin *other) {
 	for (size_t i = 0; i < other->getConstraints().size(); i++)
 		if (!_constraints.contains(other->getConstraints()[i])) _constraints.add(other->getConstraints()[i]);
 
-	AttachmentMap::Entries entries = other->getAttachments();
-	while (entries.hasNext()) {
-		AttachmentMap::Entry &entry = entries.next();
-		setAttachment(entry._slotIndex, entry._name, entry._attachment);
-	}
+	Vector<Vector<AttachmentMap::Entry>> &buckets = other->_attachments._buckets;
+	if (_attachments._buckets.size() < buckets.size())
+		_attachments._buckets.setSize(buckets.size(), Vector<AttachmentMap::Entry>());
+	for (size_t i = 0, n = buckets.size(); i < n; i++)
+		_attachments.putAll(i, buckets[i]);
+	_version++;
 }
 
 void Skin::copySkin(Skin *other) {
@@ -40,6 +40,7 @@ SlotData::SlotData(int index, const String &name, BoneData &boneData) : _index(i
 																		_darkColor(0, 0, 0, 0),
 																		_hasDarkColor(false),
 																		_attachmentName(),
+																		_attachmentId(-1),
 																		_blendMode(BlendMode_Normal),
 																		_visible(true) {
 	assert(_index >= 0);
@@ -80,6 +81,7 @@ const String &SlotData::getAttachmentName() {
 
 void SlotData::setAttachmentName(const String &inValue) {
 	_attachmentName = inValue;
+	_attachmentId = -1;
 }
 
 BlendMode SlotData::getBlendMode() {
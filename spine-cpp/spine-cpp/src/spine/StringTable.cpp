@@ -0,0 +1,139 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/StringTable.h>
+
+#include <spine/Arena.h>
+#include <spine/HashMap.h>
+
+#ifndef SPINE_NO_THREADS
+#include <mutex>
+#endif
+
+using namespace spine;
+
+// Each entry is allocated as the hash, followed by the null terminated characters. The table stores pointers to the
+// characters, so a String can use them directly and StringTable::getHash() finds the hash in front of them.
+static char **_entries = NULL;
+static size_t _capacity = 0;
+static size_t _count = 0;
+
+#ifndef SPINE_NO_THREADS
+static std::mutex &getMutex() {
+	static std::mutex mutex;
+	return mutex;
+}
+#endif
+
+static inline size_t entryHash(const char *chars) {
+	return ((const size_t *) (const void *) chars)[-1];
+}
+
+static void grow() {
+	size_t oldCapacity = _capacity;
+	char **oldEntries = _entries;
+	_capacity = oldCapacity == 0 ? 1024 : oldCapacity << 1;
+	_entries = SpineExtension::calloc<char *>(_capacity, __FILE__, __LINE__);
+	size_t mask = _capacity - 1;
+	for (size_t i = 0; i < oldCapacity; i++) {
+		char *chars = oldEntries[i];
+		if (!chars) continue;
+		size_t index = entryHash(chars) & mask;
+		while (_entries[index]) index = (index + 1) & mask;
+		_entries[index] = chars;
+	}
+	if (oldEntries) SpineExtension::free(oldEntries, __FILE__, __LINE__);
+}
+
+String StringTable::intern(const char *chars) {
+	return chars ? intern(chars, strlen(chars)) : String();
+}
+
+String StringTable::intern(const String &string) {
+	if (string.isInterned()) return string;
+	return intern(string.buffer(), string.length());
+}
+
+String StringTable::intern(const char *chars, size_t length) {
+	String result;
+	if (!chars || length == 0) return result;
+	size_t hash = hashMapString(chars, length);
+
+#ifndef SPINE_NO_THREADS
+	std::lock_guard<std::mutex> lock(getMutex());
+#endif
+	// The table outlives any arena that is current while loading.
+	ArenaScope arenaScope(NULL);
+	if ((_count + 1) * 4 > _capacity * 3) grow();
+
+	size_t mask = _capacity - 1;
+	size_t index = hash & mask;
+	for (char *entry; (entry = _entries[index]) != NULL; index = (index + 1) & mask) {
+		if (entryHash(entry) == hash && strncmp(entry, chars, length) == 0 && entry[length] == 0) {
+			result._buffer = entry;
+			result._length = length;
+			result._tempowner = false;
+			result._interned = true;
+			return result;
+		}
+	}
+
+	char *memory = SpineExtension::alloc<char>(sizeof(size_t) + length + 1, __FILE__, __LINE__);
+	*(size_t *) (void *) memory = hash;
+	char *entry = memory + sizeof(size_t);
+	memcpy(entry, chars, length);
+	entry[length] = 0;
+	_entries[index] = entry;
+	_count++;
+
+	result._buffer = entry;
+	result._length = length;
+	result._tempowner = false;
+	result._interned = true;
+	return result;
+}
+
+size_t StringTable::getCount() {
+#ifndef SPINE_NO_THREADS
+	std::lock_guard<std::mutex> lock(getMutex());
+#endif
+	return _count;
+}
+
+void StringTable::clear() {
+#ifndef SPINE_NO_THREADS
+	std::lock_guard<std::mutex> lock(getMutex());
+#endif
+	for (size_t i = 0; i < _capacity; i++)
+		if (_entries[i]) SpineExtension::free(_entries[i] - sizeof(size_t), __FILE__, __LINE__);
+	if (_entries) SpineExtension::free(_entries, __FILE__, __LINE__);
+	_entries = NULL;
+	_capacity = 0;
+	_count = 0;
+}
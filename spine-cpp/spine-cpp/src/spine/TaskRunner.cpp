@@ -0,0 +1,162 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/TaskRunner.h>
+
+#include <spine/Extension.h>
+
+#ifndef SPINE_NO_THREADS
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+using namespace spine;
+
+TaskRunner::TaskRunner() {
+}
+
+TaskRunner::~TaskRunner() {
+}
+
+SerialTaskRunner::SerialTaskRunner() {
+}
+
+SerialTaskRunner::~SerialTaskRunner() {
+}
+
+void SerialTaskRunner::run(size_t count, Task task, void *context) {
+	for (size_t i = 0; i < count; i++)
+		task(context, i);
+}
+
+#ifndef SPINE_NO_THREADS
+struct ThreadPoolTaskRunner::State {
+	std::thread *threads;
+	int threadCount;
+
+	std::mutex mutex;
+	std::condition_variable wake;
+	std::condition_variable done;
+	size_t generation;
+	int working;
+	bool quit;
+
+	Task task;
+	void *context;
+	size_t count;
+	std::atomic<size_t> next;
+
+	void work() {
+		for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1))
+			task(context, i);
+	}
+
+	void loop() {
+		size_t seen = 0;
+		std::unique_lock<std::mutex> lock(mutex);
+		while (true) {
+			while (!quit && generation == seen) wake.wait(lock);
+			if (quit) return;
+			seen = generation;
+			lock.unlock();
+			work();
+			lock.lock();
+			if (--working == 0) done.notify_one();
+		}
+	}
+
+	static void run(State *state) {
+		state->loop();
+	}
+};
+
+ThreadPoolTaskRunner::ThreadPoolTaskRunner(int threadCount) : _state(NULL) {
+	if (threadCount < 0) threadCount = (int) std::thread::hardware_concurrency() - 1;
+	if (threadCount < 0) threadCount = 0;
+
+	_state = new (SpineExtension::calloc<State>(1, __FILE__, __LINE__)) State();
+	_state->threadCount = threadCount;
+	_state->generation = 0;
+	_state->working = 0;
+	_state->quit = false;
+	_state->task = NULL;
+	_state->context = NULL;
+	_state->count = 0;
+	_state->next = 0;
+	_state->threads = threadCount > 0 ? SpineExtension::calloc<std::thread>(threadCount, __FILE__, __LINE__) : NULL;
+	for (int i = 0; i < threadCount; i++)
+		new (_state->threads + i) std::thread(State::run, _state);
+}
+
+ThreadPoolTaskRunner::~ThreadPoolTaskRunner() {
+	{
+		std::lock_guard<std::mutex> lock(_state->mutex);
+		_state->quit = true;
+	}
+	_state->wake.notify_all();
+	for (int i = 0; i < _state->threadCount; i++) {
+		_state->threads[i].join();
+		_state->threads[i].~thread();
+	}
+	if (_state->threads) SpineExtension::free(_state->threads, __FILE__, __LINE__);
+	_state->~State();
+	SpineExtension::free(_state, __FILE__, __LINE__);
+}
+
+void ThreadPoolTaskRunner::run(size_t count, Task task, void *context) {
+	if (count == 0) return;
+	if (_state->threadCount == 0 || count == 1) {
+		for (size_t i = 0; i < count; i++)
+			task(context, i);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_state->mutex);
+		_state->task = task;
+		_state->context = context;
+		_state->count = count;
+		_state->next = 0;
+		_state->working = _state->threadCount;
+		_state->generation++;
+	}
+	_state->wake.notify_all();
+
+	_state->work();
+
+	std::unique_lock<std::mutex> lock(_state->mutex);
+	while (_state->working > 0) _state->done.wait(lock);
+}
+
+int ThreadPoolTaskRunner::getThreadCount() {
+	return _state->threadCount;
+}
+#endif
@@ -166,7 +166,8 @@ void TransformConstraint::applyAbsoluteWorld() {
 				r += MathUtil::Pi_2;
 
 			r *= mixRotate;
-			float cos = MathUtil::cos(r), sin = MathUtil::sin(r);
+			float sin, cos;
+			MathUtil::sinCos(r, sin, cos);
 			bone._a = cos * a - sin * c;
 			bone._b = cos * b - sin * d;
 			bone._c = sin * a + cos * c;
@@ -205,8 +206,10 @@ void TransformConstraint::applyAbsoluteWorld() {
 
 			r = by + (r + offsetShearY) * mixShearY;
 			float s = MathUtil::sqrt(b * b + d * d);
-			bone._b = MathUtil::cos(r) * s;
-			bone._d = MathUtil::sin(r) * s;
+			float sin, cos;
+			MathUtil::sinCos(r, sin, cos);
+			bone._b = cos * s;
+			bone._d = sin * s;
 		}
 
 		bone.updateAppliedTransform();
@@ -233,7 +236,8 @@ void TransformConstraint::applyRelativeWorld() {
 				r += MathUtil::Pi_2;
 
 			r *= mixRotate;
-			float cos = MathUtil::cos(r), sin = MathUtil::sin(r);
+			float sin, cos;
+			MathUtil::sinCos(r, sin, cos);
 			bone._a = cos * a - sin * c;
 			bone._b = cos * b - sin * d;
 			bone._c = sin * a + cos * c;
@@ -268,8 +272,10 @@ void TransformConstraint::applyRelativeWorld() {
 			float b = bone._b, d = bone._d;
 			r = MathUtil::atan2(d, b) + (r - MathUtil::Pi / 2 + offsetShearY) * mixShearY;
 			float s = MathUtil::sqrt(b * b + d * d);
-			bone._b = MathUtil::cos(r) * s;
-			bone._d = MathUtil::sin(r) * s;
+			float sin, cos;
+			MathUtil::sinCos(r, sin, cos);
+			bone._b = cos * s;
+			bone._d = sin * s;
 		}
 
 		bone.updateAppliedTransform();
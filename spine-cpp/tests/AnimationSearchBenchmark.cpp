@@ -0,0 +1,148 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Measures applying every animation of the example skeletons at 60 frames per second and a long synthetic rotate
+// timeline, and the keyframe search alone, Animation::search() against the linear scan it replaced.
+
+#include "TestUtil.h"
+
+using namespace spine;
+
+static const char *names[] = {"spineboy", "raptor", "owl", "tank", "stretchyman", "goblins", "mix-and-match",
+							  "celestial-circus", "dragon", "vine"};
+
+// The previous Animation::search(), a linear scan over all frames.
+static int linearSearch(Vector<float> &frames, float target, int step) {
+	size_t n = frames.size();
+	for (size_t i = step; i < n; i += step)
+		if (frames[i] > target) return (int) (i - step);
+	return (int) (n - step);
+}
+
+static const int searchRounds = 20;
+
+// Both searches are called through pointers, so the linear scan isn't inlined into the loop where the library's
+// search can't be.
+typedef int (*Search)(Vector<float> &frames, float target, int step);
+static Search volatile binarySearch = Animation::search;
+static Search volatile linearSearchPointer = linearSearch;
+
+// Search time totals in seconds and number of searches, for timelines with up to 8, 16, 64 and more frames.
+struct SearchTimes {
+	double binary[4], linear[4];
+	long count[4];
+};
+
+static void timeSearches(Timeline *timeline, float duration, SearchTimes &times) {
+	Vector<float> &frames = timeline->getFrames();
+	int step = (int) timeline->getFrameEntries();
+	size_t frameCount = timeline->getFrameCount();
+	int bucket = frameCount <= 8 ? 0 : frameCount <= 16 ? 1 : frameCount <= 64 ? 2 : 3;
+	int steps = (int) (duration * 60) + 1;
+	int found = 0;
+	Search search = binarySearch;
+	double start = timeSeconds();
+	for (int round = 0; round < searchRounds; round++) {
+		for (int i = 0; i < steps; i++)
+			found += search(frames, i / 60.0f, step);
+	}
+	times.binary[bucket] += timeSeconds() - start;
+	search = linearSearchPointer;
+	start = timeSeconds();
+	for (int round = 0; round < searchRounds; round++) {
+		for (int i = 0; i < steps; i++)
+			found -= search(frames, i / 60.0f, step);
+	}
+	times.linear[bucket] += timeSeconds() - start;
+	times.count[bucket] += steps * searchRounds;
+	SPINE_CHECK(found == 0);
+}
+
+// Applies the animation at 60 frames per second over its duration, rounds times. Returns the seconds per apply.
+static double timeApply(Skeleton &skeleton, Animation *animation, int rounds) {
+	int steps = (int) (animation->getDuration() * 60) + 1;
+	double start = timeSeconds();
+	for (int round = 0; round < rounds; round++) {
+		for (int i = 0; i < steps; i++) {
+			float time = i / 60.0f;
+			animation->apply(skeleton, time, time, true, NULL, 1, MixBlend_Replace, MixDirection_In);
+		}
+	}
+	return (timeSeconds() - start) / ((double) rounds * steps);
+}
+
+int main() {
+	SearchTimes searchTimes;
+	memset(&searchTimes, 0, sizeof(searchTimes));
+	double applyTotal = 0;
+	int applyCount = 0;
+	for (size_t n = 0; n < sizeof(names) / sizeof(names[0]); n++) {
+		TestSkeleton test;
+		if (!test.load(names[n])) return 1;
+		Skeleton skeleton(test.data);
+		if (test.data->getSkins().size() > 1) skeleton.setSkin(test.data->getSkins()[1]);
+		skeleton.setToSetupPose();
+		Vector<Animation *> &animations = test.data->getAnimations();
+		for (size_t i = 0; i < animations.size(); i++) {
+			Animation *animation = animations[i];
+			applyTotal += timeApply(skeleton, animation, 100);
+			applyCount++;
+			Vector<Timeline *> &timelines = animation->getTimelines();
+			for (size_t ii = 0; ii < timelines.size(); ii++)
+				timeSearches(timelines[ii], animation->getDuration(), searchTimes);
+		}
+	}
+	printf("%d example animations: %.2f us per apply on average\n", applyCount, applyTotal / applyCount * 1e6);
+	static const char *buckets[] = {"<= 8", "9 to 16", "17 to 64", "> 64"};
+	for (int i = 0; i < 4; i++) {
+		if (!searchTimes.count[i]) continue;
+		printf("Example timelines with %s frames, %ld searches: %.1f ns per search vs %.1f ns linear\n", buckets[i],
+			   searchTimes.count[i], searchTimes.binary[i] / searchTimes.count[i] * 1e9,
+			   searchTimes.linear[i] / searchTimes.count[i] * 1e9);
+	}
+
+	// A rotate timeline keyed every frame for a minute, as baked or motion captured animations are.
+	TestSkeleton spineboy;
+	if (!spineboy.load("spineboy")) return 1;
+	Skeleton skeleton(spineboy.data);
+	static const int frameCount = 3600;
+	RotateTimeline *timeline = new RotateTimeline(frameCount, 0, 1);
+	for (int i = 0; i < frameCount; i++)
+		timeline->setFrame(i, i / 60.0f, (float) (i % 360));
+	Vector<Timeline *> timelines;
+	timelines.add(timeline);
+	Animation animation("synthetic", timelines, frameCount / 60.0f);
+	double apply = timeApply(skeleton, &animation, 5);
+	SearchTimes longTimes;
+	memset(&longTimes, 0, sizeof(longTimes));
+	timeSearches(timeline, animation.getDuration(), longTimes);
+	printf("Rotate timeline with %d frames: %.1f ns per apply, %.1f ns per search vs %.1f ns linear\n", frameCount,
+		   apply * 1e9, longTimes.binary[3] / longTimes.count[3] * 1e9, longTimes.linear[3] / longTimes.count[3] * 1e9);
+	return testResult("AnimationSearchBenchmark");
+}
@@ -0,0 +1,180 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Checks that skeleton data loaded into an arena only allocates what it owns from the arena, so a custom attachment
+// loader can free its allocations after the data was deleted, and that the data can be changed after loading.
+
+#include "TestUtil.h"
+
+using namespace spine;
+
+class TestAttachmentLoader : public AtlasAttachmentLoader {
+public:
+	Vector<Vector<float> *> rendererObjects;
+	int arenaCalls;
+
+	explicit TestAttachmentLoader(Atlas *atlas) : AtlasAttachmentLoader(atlas), arenaCalls(0) {
+	}
+
+	virtual RegionAttachment *newRegionAttachment(Skin &skin, const String &name, const String &path, Sequence *sequence) {
+		if (Arena::getCurrent()) arenaCalls++;
+		return AtlasAttachmentLoader::newRegionAttachment(skin, name, path, sequence);
+	}
+
+	virtual void configureAttachment(Attachment *attachment) {
+		if (Arena::getCurrent()) arenaCalls++;
+		AtlasAttachmentLoader::configureAttachment(attachment);
+		Vector<float> *rendererObject = new Vector<float>();
+		rendererObject->setSize(16, 0);
+		rendererObjects.add(rendererObject);
+	}
+};
+
+static void testLoad(Atlas *atlas, bool json) {
+	char path[1024];
+	snprintf(path, sizeof(path), "%s/spineboy/export/spineboy-pro.%s", SPINE_EXAMPLES_DIR, json ? "json" : "skel");
+	TestAttachmentLoader loader(atlas);
+	SkeletonData *data;
+	if (json) {
+		SkeletonJson reader(&loader);
+		reader.setUseArena(true);
+		data = reader.readSkeletonDataFile(path);
+	} else {
+		SkeletonBinary reader(&loader);
+		reader.setUseArena(true);
+		data = reader.readSkeletonDataFile(path);
+	}
+	SPINE_CHECK(data != NULL);
+	if (!data) return;
+	SPINE_CHECK(Arena::getCurrent() == NULL);
+	SPINE_CHECK(data->getArena() != NULL);
+	SPINE_CHECK(loader.arenaCalls == 0);
+	SPINE_CHECK(loader.rendererObjects.size() > 0);
+	for (size_t i = 0; i < loader.rendererObjects.size(); i++) {
+		SPINE_CHECK(!data->getArena()->owns(loader.rendererObjects[i]));
+		SPINE_CHECK(!data->getArena()->owns(loader.rendererObjects[i]->buffer()));
+	}
+	SPINE_CHECK(data->getArena()->owns(data->getBones()[0]));
+	delete data;
+
+	// Freed without an arena after the data is gone.
+	for (size_t i = 0; i < loader.rendererObjects.size(); i++)
+		delete loader.rendererObjects[i];
+}
+
+// Grows, shrinks and frees memory owned by the data's arena without it being current, with no arena and with another
+// arena current.
+static void testChangeAfterLoad(Atlas *atlas) {
+	char path[1024];
+	snprintf(path, sizeof(path), "%s/spineboy/export/spineboy-pro.skel", SPINE_EXAMPLES_DIR);
+	AtlasAttachmentLoader loader(atlas);
+	SkeletonBinary reader(&loader);
+	reader.setUseArena(true);
+	SkeletonData *data = reader.readSkeletonDataFile(path);
+	SPINE_CHECK(data != NULL);
+	if (!data) return;
+	Arena *arena = data->getArena();
+	SPINE_CHECK(Arena::findOwner(data->getBones()[0]) == arena);
+	SPINE_CHECK(Arena::findOwner(data) == NULL);
+
+	Skin *skin = data->getDefaultSkin();
+	Skin::AttachmentMap::Entries entries = skin->getAttachments();
+	SPINE_CHECK(entries.hasNext());
+	Skin::AttachmentMap::Entry &entry = entries.next();
+	size_t slotIndex = entry._slotIndex;
+	String entryName = entry._name;
+	Attachment *attachment = entry._attachment;
+	char name[32];
+	for (int i = 0; i < 64; i++) {
+		snprintf(name, sizeof(name), "added%d", i);
+		skin->setAttachment(slotIndex, name, attachment->copy());
+	}
+	skin->removeAttachment(slotIndex, entryName);
+	skin->removeAttachment(slotIndex, "added0");
+
+	Vector<Timeline *> timelines;
+	Vector<Animation *> &animations = data->getAnimations();
+	size_t animationCount = animations.size();
+	for (int i = 0; i < 64; i++)
+		animations.add(new (__FILE__, __LINE__) Animation("added", timelines, 1));
+	SPINE_CHECK(!arena->owns(animations.buffer()));
+
+	Vector<BoneData *> &bones = data->getBones();
+	SPINE_CHECK(arena->owns(bones.buffer()));
+	bones.ensureCapacity(bones.size() * 2);
+	SPINE_CHECK(Arena::findOwner(bones.buffer()) == NULL);
+	SPINE_CHECK(arena->owns(bones[0]));
+
+	{
+		// Only frees, anything allocated here would be released with the other arena.
+		Arena other;
+		ArenaScope scope(&other);
+		Animation *animation = animations[0];
+		SPINE_CHECK(arena->owns(animation));
+		animations.removeAt(0);
+		animationCount--;
+		delete animation;
+		SPINE_CHECK(other.getSize() > 0 && other.getWaste() == other.getSize());
+	}
+	while (animations.size() > animationCount) {
+		delete animations[animations.size() - 1];
+		animations.removeAt(animations.size() - 1);
+	}
+
+	SPINE_CHECK(skin->getAttachment(slotIndex, "added63") != NULL);
+	SPINE_CHECK(skin->getAttachment(slotIndex, "added0") == NULL);
+	delete data;
+	SPINE_CHECK(Arena::findOwner(attachment) == NULL);
+}
+
+static void testScope() {
+	Arena arena;
+	ArenaScope outer(&arena);
+	{
+		ArenaScope inner(NULL);
+		SPINE_CHECK(Arena::getCurrent() == NULL);
+		inner.exit();
+		SPINE_CHECK(Arena::getCurrent() == &arena);
+		inner.exit();
+		SPINE_CHECK(Arena::getCurrent() == &arena);
+	}
+	SPINE_CHECK(Arena::getCurrent() == &arena);
+	outer.exit();
+	SPINE_CHECK(Arena::getCurrent() == NULL);
+}
+
+int main() {
+	TestSkeleton spineboy;
+	if (!spineboy.load("spineboy")) return 1;
+	testLoad(spineboy.atlas, false);
+	testLoad(spineboy.atlas, true);
+	testChangeAfterLoad(spineboy.atlas);
+	testScope();
+	return testResult("ArenaTest");
+}
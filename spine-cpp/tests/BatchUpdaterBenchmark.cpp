@@ -0,0 +1,100 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Measures SkeletonBatchUpdater updating many spineboy instances per frame on the calling thread only and with a
+// ThreadPoolTaskRunner using each number of worker threads the hardware has, without and with rendering.
+
+#include "TestUtil.h"
+
+#include <thread>
+
+using namespace spine;
+
+static const int numInstances = 256;
+static const int frames = 200;
+static const float delta = 1 / 60.0f;
+
+// Returns the seconds per frame and stores the world position of the last instance's last bone.
+static double run(SkeletonData *data, AnimationStateData *stateData, int threadCount, bool render, float *x, float *y) {
+	TaskRunner *taskRunner = threadCount > 0 ? new ThreadPoolTaskRunner(threadCount) : NULL;
+	SkeletonBatchUpdater updater(taskRunner, true);
+	updater.setRender(render);
+	Vector<Skeleton *> skeletons;
+	Vector<AnimationState *> states;
+	for (int i = 0; i < numInstances; i++) {
+		Skeleton *skeleton = new Skeleton(data);
+		AnimationState *state = new AnimationState(stateData);
+		state->setAnimation(0, i & 1 ? "run" : "walk", true)->setTrackTime(i * 0.01f);
+		skeleton->setToSetupPose();
+		updater.add(state, skeleton, delta);
+		skeletons.add(skeleton);
+		states.add(state);
+	}
+
+	updater.update(Physics_Update);
+	double start = timeSeconds();
+	for (int i = 0; i < frames; i++)
+		updater.update(Physics_Update);
+	double time = (timeSeconds() - start) / frames;
+
+	Bone *bone = skeletons[numInstances - 1]->getBones()[skeletons[numInstances - 1]->getBones().size() - 1];
+	*x = bone->getWorldX();
+	*y = bone->getWorldY();
+	for (int i = 0; i < numInstances; i++) {
+		delete states[i];
+		delete skeletons[i];
+	}
+	return time;
+}
+
+int main() {
+	TestSkeleton spineboy;
+	if (!spineboy.load("spineboy")) return 1;
+	AnimationStateData stateData(spineboy.data);
+
+	int maxThreads = (int) std::thread::hardware_concurrency() - 1;
+	if (maxThreads < 1) maxThreads = 1;
+	float serialX = 0, serialY = 0;
+	for (int render = 0; render < 2; render++) {
+		for (int threads = 0; threads <= maxThreads; threads++) {
+			float x, y;
+			double time = run(spineboy.data, &stateData, threads, render != 0, &x, &y);
+			if (threads == 0) {
+				serialX = x;
+				serialY = y;
+			} else {
+				// Instances don't share state, so the pose doesn't depend on the number of threads.
+				SPINE_CHECK(x == serialX && y == serialY);
+			}
+			printf("%d instances, %d worker threads%s: %.3f ms per frame\n", numInstances, threads,
+				   render ? ", rendered" : "", time * 1e3);
+		}
+	}
+	return testResult("BatchUpdaterBenchmark");
+}
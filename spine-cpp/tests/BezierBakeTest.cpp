@@ -0,0 +1,162 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Checks how far CurveTimeline::getBezierValue() of baked beziers, see CurveTimeline::bakeBeziers(), is from the
+// unbaked evaluation for every bezier of the example animations, with several sample counts. The difference is
+// relative to the range of values the curve covers. Between two samples the baked value is never further off than the
+// unbaked value changes there, so the steepest curves are furthest off. A bezier whose control points make time go
+// backward has more than one value at some times and the unbaked evaluation jumps between them, which no number of
+// samples reproduces, so for those the baked values are only checked to stay within that range.
+
+#include "TestUtil.h"
+
+using namespace spine;
+
+static const char *names[] = {"alien", "celestial-circus", "coin", "dragon", "goblins", "hero", "mix-and-match", "owl",
+							  "powerup", "raptor", "sack", "snowglobe", "speedy", "spineboy",
+							  "stretchyman", "tank", "vine", "windmill"};
+
+// The sample counts and the largest difference for them documented in SkeletonJson::setBezierSamples().
+static const size_t sampleCounts[] = {8, 16, 32, 64};
+static const float bounds[] = {0.35f, 0.22f, 0.13f, 0.045f};
+static const int numSampleCounts = 4;
+
+// CurveTimeline's curve types and bezier size, which are protected.
+static const int BEZIER = 2;
+static const int BEZIER_SIZE = 18;
+
+// Times evaluated per bezier, more than the largest sample count so values between the samples are checked.
+static const int STEPS = 256;
+
+static float maxDifferences[numSampleCounts];
+static int over1Percent[numSampleCounts];
+static int numBeziers = 0, numBackward = 0, failures = 0;
+
+// Evaluates each bezier of the timeline, unbaked and then baked with each sample count.
+static void testTimeline(CurveTimeline *timeline) {
+	Vector<float> &frames = timeline->getFrames();
+	Vector<float> &curves = timeline->getCurves();
+	size_t frameEntries = timeline->getFrameEntries(), frameCount = timeline->getFrameCount();
+	size_t bezierCount = (curves.size() - frameCount) / BEZIER_SIZE;
+	if (bezierCount == 0 || frameEntries < 2) return;
+
+	float unbaked[STEPS + 1];
+	for (size_t frame = 0; frame < frameCount - 1; frame++) {
+		int curveType = (int) curves[frame];
+		if (curveType < BEZIER) continue;
+		// The frame's beziers, one per value, end where the next bezier frame's start.
+		size_t first = (curveType - BEZIER - frameCount) / BEZIER_SIZE, end = bezierCount;
+		for (size_t next = frame + 1; next < frameCount - 1; next++) {
+			if ((int) curves[next] >= BEZIER) {
+				end = ((int) curves[next] - BEZIER - frameCount) / BEZIER_SIZE;
+				break;
+			}
+		}
+		size_t frameIndex = frame * frameEntries;
+		float x = frames[frameIndex], duration = frames[frameIndex + frameEntries] - x;
+		for (size_t bezier = first; bezier < end && 1 + bezier - first < frameEntries; bezier++) {
+			size_t valueOffset = 1 + bezier - first, i = frameCount + bezier * BEZIER_SIZE;
+			timeline->bakeBeziers(0);
+			float min = frames[frameIndex + valueOffset], max = min;
+			for (int step = 0; step <= STEPS; step++) {
+				float value = timeline->getBezierValue(x + duration * step / STEPS, frameIndex, valueOffset, i);
+				unbaked[step] = value;
+				min = MathUtil::min(min, value);
+				max = MathUtil::max(max, value);
+			}
+			float range = max - min;
+			if (range < 1e-4f) continue;
+			bool backward = curves[i] < x;
+			for (int n = 2; n < BEZIER_SIZE; n += 2)
+				backward |= curves[i + n] < curves[i + n - 2];
+			backward |= frames[frameIndex + frameEntries] < curves[i + BEZIER_SIZE - 2];
+			if (backward)
+				numBackward++;
+			else
+				numBeziers++;
+			for (int s = 0; s < numSampleCounts; s++) {
+				timeline->bakeBeziers(sampleCounts[s]);
+				int stepsPerSample = STEPS / (int) sampleCounts[s];
+				float maxDifference = 0;
+				for (int sample = 0; sample < (int) sampleCounts[s]; sample++) {
+					// How much the unbaked value changes between the two samples.
+					float sampleMin = unbaked[sample * stepsPerSample], sampleMax = sampleMin;
+					for (int step = sample * stepsPerSample; step <= (sample + 1) * stepsPerSample; step++) {
+						sampleMin = MathUtil::min(sampleMin, unbaked[step]);
+						sampleMax = MathUtil::max(sampleMax, unbaked[step]);
+					}
+					for (int step = sample * stepsPerSample; step <= (sample + 1) * stepsPerSample; step++) {
+						float value = timeline->getBezierValue(x + duration * step / STEPS, frameIndex, valueOffset, i);
+						float tolerance = range * 1e-4f;
+						if (backward) {
+							if (value < min - tolerance || value > max + tolerance) failures++;
+						} else {
+							if (MathUtil::abs(value - unbaked[step]) > sampleMax - sampleMin + tolerance) failures++;
+							maxDifference = MathUtil::max(maxDifference, MathUtil::abs(value - unbaked[step]) / range);
+						}
+					}
+				}
+				if (backward) continue;
+				maxDifferences[s] = MathUtil::max(maxDifferences[s], maxDifference);
+				if (maxDifference > 0.01f) over1Percent[s]++;
+			}
+		}
+	}
+	timeline->bakeBeziers(0);
+}
+
+static void testSkeleton(const char *name) {
+	TestSkeleton test;
+	if (!test.load(name)) {
+		testFailures++;
+		return;
+	}
+	Vector<Animation *> &animations = test.data->getAnimations();
+	for (size_t a = 0; a < animations.size(); a++) {
+		Vector<Timeline *> &timelines = animations[a]->getTimelines();
+		for (size_t t = 0; t < timelines.size(); t++) {
+			if (timelines[t]->getRTTI().instanceOf(CurveTimeline::rtti))
+				testTimeline(static_cast<CurveTimeline *>(timelines[t]));
+		}
+	}
+}
+
+int main() {
+	for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++)
+		testSkeleton(names[i]);
+	SPINE_CHECK(numBeziers > 0);
+	SPINE_CHECK(failures == 0);
+	printf("%d beziers, %d going backward in time\n", numBeziers, numBackward);
+	for (int s = 0; s < numSampleCounts; s++) {
+		printf("%d samples: largest difference %.5f of the curve's range, %d beziers over 0.01\n", (int) sampleCounts[s],
+			   maxDifferences[s], over1Percent[s]);
+		SPINE_CHECK(maxDifferences[s] <= bounds[s]);
+	}
+	return testResult("BezierBakeTest");
+}
@@ -0,0 +1,137 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Measures the cost of sine and cosine per angle and of Skeleton::updateWorldTransform() per bone, with and without the
+// pose buffer. The trig backend is the one the library was built with, configure with
+// -DCMAKE_CXX_FLAGS=-DSPINE_FAST_TRIG to measure the polynomial approximation.
+
+#include "TestUtil.h"
+
+using namespace spine;
+
+static const int numAngles = 4096;
+static const int angleRepeats = 2000;
+
+static void benchmarkTrig() {
+	static float radians[numAngles], sin[numAngles], cos[numAngles];
+	for (int i = 0; i < numAngles; i++)
+		radians[i] = (i - numAngles / 2) * 0.37f;
+	float sum = 0;
+
+	double start = timeSeconds();
+	for (int r = 0; r < angleRepeats; r++)
+		for (int i = 0; i < numAngles; i++)
+			sum += MathUtil::sin(radians[i]) + MathUtil::cos(radians[i]);
+	double separate = timeSeconds() - start;
+
+	start = timeSeconds();
+	for (int r = 0; r < angleRepeats; r++) {
+		for (int i = 0; i < numAngles; i++) {
+			MathUtil::sinCos(radians[i], sin[i], cos[i]);
+			sum += sin[i] + cos[i];
+		}
+	}
+	double fused = timeSeconds() - start;
+
+	start = timeSeconds();
+	for (int r = 0; r < angleRepeats; r++) {
+		MathUtil::sinCos(radians, sin, cos, numAngles);
+		sum += sin[r % numAngles] + cos[r % numAngles];
+	}
+	double batch = timeSeconds() - start;
+
+	double scale = 1e9 / ((double) numAngles * angleRepeats);
+	printf("sin + cos: %.2f ns, sinCos: %.2f ns, batched sinCos: %.2f ns per angle (%g)\n", separate * scale,
+		   fused * scale, batch * scale, sum);
+}
+
+// A chain of branches, so runs of bones in the update cache are long and most parents are not the previous bone.
+static SkeletonData *newRig(int numBones) {
+	SkeletonData *data = new SkeletonData();
+	Vector<BoneData *> &bones = data->getBones();
+	for (int i = 0; i < numBones; i++) {
+		char name[32];
+		snprintf(name, sizeof(name), "bone%d", i);
+		BoneData *parent = i == 0 ? NULL : bones[i < 8 ? i - 1 : i - 8];
+		BoneData *bone = new BoneData(i, String(name), parent);
+		bone->setLength(20);
+		bone->setX(i == 0 ? 0 : 20);
+		bone->setRotation((float) (i % 17));
+		bones.add(bone);
+	}
+	data->updateNameIndex();
+	return data;
+}
+
+static double benchmarkBones(SkeletonData *data, bool usePoseBuffer, int frames) {
+	Skeleton skeleton(data);
+	skeleton.setUsePoseBuffer(usePoseBuffer);
+	Vector<Bone *> &bones = skeleton.getBones();
+	double time = 0;
+	for (int frame = 0; frame < frames; frame++) {
+		for (size_t i = 0; i < bones.size(); i++)
+			bones[i]->setRotation((float) (frame % 360) + i);
+		double start = timeSeconds();
+		skeleton.updateWorldTransform(Physics_None);
+		time += timeSeconds() - start;
+	}
+	return time * 1e9 / ((double) frames * bones.size());
+}
+
+static void benchmarkRig() {
+	SkeletonData *data = newRig(1000);
+	double scalar = 1e9, batched = 1e9;
+	for (int run = 0; run < 5; run++) {
+		scalar = MathUtil::min(scalar, benchmarkBones(data, false, 2000));
+		batched = MathUtil::min(batched, benchmarkBones(data, true, 2000));
+	}
+	printf("1000 bone rig: %.2f ns per bone, %.2f ns with the pose buffer\n", scalar, batched);
+
+	// Both paths give the same pose.
+	Skeleton a(data), b(data);
+	b.setUsePoseBuffer(true);
+	a.updateWorldTransform(Physics_None);
+	b.updateWorldTransform(Physics_None);
+	for (size_t i = 0; i < a.getBones().size(); i++)
+		SPINE_CHECK(a.getBones()[i]->getWorldX() == b.getBones()[i]->getWorldX());
+	delete data;
+}
+
+int main() {
+#if defined(SPINE_FAST_TRIG)
+	printf("Trig backend: SPINE_FAST_TRIG\n");
+#elif defined(SPINE_FLOAT_TRIG)
+	printf("Trig backend: SPINE_FLOAT_TRIG\n");
+#else
+	printf("Trig backend: default\n");
+#endif
+	benchmarkTrig();
+	benchmarkRig();
+	return testResult("BoneUpdateBenchmark");
+}
@@ -0,0 +1,107 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Measures SkeletonClipping::clipTriangles() for a dense mesh under a concave clipping attachment, with triangles
+// inside and outside the clipping polygons accepted and rejected up front and with every triangle going through clip().
+
+#include "TestUtil.h"
+
+#include <math.h>
+
+using namespace spine;
+
+static const int gridSize = 64;
+static const int iterations = 200;
+
+int main() {
+	SkeletonData data;
+	BoneData *boneData = new BoneData(0, "root", NULL);
+	data.getBones().add(boneData);
+	SlotData *slotData = new SlotData(0, "clip", *boneData);
+	data.getSlots().add(slotData);
+	Skeleton skeleton(&data);
+	skeleton.updateWorldTransform(Physics_None);
+	Slot &slot = *skeleton.getSlots()[0];
+
+	// A 12 pointed star over the middle of the mesh, so there are triangles fully inside, fully outside and straddling
+	// the edges of each of its convex pieces.
+	ClippingAttachment clip("clip");
+	clip.setEndSlot(slotData);
+	for (int i = 0; i < 24; i++) {
+		float radius = i & 1 ? 30.0f : 45.0f, angle = -i * MathUtil::Pi / 12;
+		clip.getVertices().add(50 + radius * cosf(angle));
+		clip.getVertices().add(50 + radius * sinf(angle));
+	}
+	clip.setWorldVerticesLength(48);
+	clip.updateConvexPolygons();
+
+	Vector<float> vertices, uvs;
+	Vector<unsigned short> triangles;
+	for (int y = 0; y <= gridSize; y++) {
+		for (int x = 0; x <= gridSize; x++) {
+			vertices.add(x * 100.0f / gridSize);
+			vertices.add(y * 100.0f / gridSize);
+			uvs.add(x / (float) gridSize);
+			uvs.add(y / (float) gridSize);
+		}
+	}
+	for (int y = 0; y < gridSize; y++) {
+		for (int x = 0; x < gridSize; x++) {
+			unsigned short i = (unsigned short) (y * (gridSize + 1) + x), below = (unsigned short) (i + gridSize + 1);
+			unsigned short quad[] = {i, (unsigned short) (i + 1), (unsigned short) (below + 1),
+									 i, (unsigned short) (below + 1), below};
+			for (int ii = 0; ii < 6; ii++)
+				triangles.add(quad[ii]);
+		}
+	}
+
+	SkeletonClipping clipping;
+	size_t polygons = clipping.clipStart(slot, &clip);
+	double times[2];
+	size_t clippedTriangles[2];
+	for (int classify = 0; classify < 2; classify++) {
+		clipping.setClassifyTriangles(classify != 0);
+		double best = 1e9;
+		for (int run = 0; run < 3; run++) {
+			double start = timeSeconds();
+			for (int i = 0; i < iterations; i++)
+				clipping.clipTriangles(vertices, triangles, uvs, 2);
+			best = MathUtil::min(best, (timeSeconds() - start) / iterations);
+		}
+		times[classify] = best;
+		clippedTriangles[classify] = clipping.getClippedTriangles().size() / 3;
+	}
+	clipping.clipEnd();
+	SPINE_CHECK(clippedTriangles[0] == clippedTriangles[1]);
+
+	printf("%d triangles, %d convex clipping polygons, %d clipped triangles: %.1f us, %.1f us with every triangle "
+		   "clipped\n", (int) triangles.size() / 3, (int) polygons, (int) clippedTriangles[1], times[1] * 1e6,
+		   times[0] * 1e6);
+	return testResult("ClippingBenchmark");
+}
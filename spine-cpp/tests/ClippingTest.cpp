@@ -0,0 +1,146 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Checks that SkeletonClipping gives the same clipped vertices, triangles and UVs when triangles inside or outside a
+// clipping polygon are accepted or rejected up front as when every triangle goes through clip(), for a mesh whose
+// vertices lie on the polygon edges and corners.
+
+#include "TestUtil.h"
+
+using namespace spine;
+
+// A grid from -50 to 150 with a vertex every 12.5, so rows, columns and diagonals of vertices lie exactly on the edges
+// of the polygons below. Quads are split along alternating diagonals.
+static const int gridSize = 17;
+static const float gridStep = 12.5f;
+
+static void newGrid(Vector<float> &vertices, Vector<float> &uvs, Vector<unsigned short> &triangles) {
+	for (int y = 0; y < gridSize; y++) {
+		for (int x = 0; x < gridSize; x++) {
+			vertices.add(-50 + x * gridStep);
+			vertices.add(-50 + y * gridStep);
+			uvs.add(x / (float) (gridSize - 1));
+			uvs.add(y / (float) (gridSize - 1));
+		}
+	}
+	for (int y = 0; y < gridSize - 1; y++) {
+		for (int x = 0; x < gridSize - 1; x++) {
+			unsigned short i = (unsigned short) (y * gridSize + x);
+			unsigned short quad[] = {i, (unsigned short) (i + 1), (unsigned short) (i + gridSize + 1),
+									 (unsigned short) (i + gridSize)};
+			int d = (x + y) & 1;
+			unsigned short split[] = {quad[d], quad[d + 1], quad[d + 2], quad[d + 2], quad[(d + 3) & 3], quad[d]};
+			for (int ii = 0; ii < 6; ii++)
+				triangles.add(split[ii]);
+		}
+	}
+}
+
+static bool same(Vector<float> &a, Vector<float> &b) {
+	if (a.size() != b.size()) return false;
+	for (size_t i = 0; i < a.size(); i++)
+		if (a[i] != b[i]) return false;
+	return true;
+}
+
+static bool same(Vector<unsigned short> &a, Vector<unsigned short> &b) {
+	if (a.size() != b.size()) return false;
+	for (size_t i = 0; i < a.size(); i++)
+		if (a[i] != b[i]) return false;
+	return true;
+}
+
+static void testPolygon(const char *name, const float *polygon, int polygonLength, bool cached, float rotation) {
+	SkeletonData data;
+	BoneData *boneData = new BoneData(0, "root", NULL);
+	boneData->setRotation(rotation);
+	data.getBones().add(boneData);
+	SlotData *slotData = new SlotData(0, "clip", *boneData);
+	data.getSlots().add(slotData);
+	Skeleton skeleton(&data);
+	skeleton.updateWorldTransform(Physics_None);
+	Slot &slot = *skeleton.getSlots()[0];
+
+	ClippingAttachment clip("clip");
+	clip.setEndSlot(slotData);
+	for (int i = 0; i < polygonLength; i++)
+		clip.getVertices().add(polygon[i]);
+	clip.setWorldVerticesLength(polygonLength);
+	if (cached) clip.updateConvexPolygons();
+
+	Vector<float> vertices, uvs;
+	Vector<unsigned short> triangles;
+	newGrid(vertices, uvs, triangles);
+
+	SkeletonClipping classified, clipped;
+	clipped.setClassifyTriangles(false);
+	classified.clipStart(slot, &clip);
+	clipped.clipStart(slot, &clip);
+
+	classified.clipTriangles(vertices, triangles, uvs, 2);
+	clipped.clipTriangles(vertices, triangles, uvs, 2);
+	if (!same(classified.getClippedVertices(), clipped.getClippedVertices()) ||
+		!same(classified.getClippedTriangles(), clipped.getClippedTriangles()) ||
+		!same(classified.getClippedUVs(), clipped.getClippedUVs())) {
+		printf("%s%s, rotation %g: classified triangles differ with UVs, %d vs %d vertices\n", name,
+			   cached ? " cached" : "", rotation, (int) classified.getClippedVertices().size(),
+			   (int) clipped.getClippedVertices().size());
+		testFailures++;
+	}
+	SPINE_CHECK(clipped.getClippedTriangles().size() > 0);
+
+	classified.clipTriangles(vertices.buffer(), triangles.buffer(), triangles.size());
+	clipped.clipTriangles(vertices.buffer(), triangles.buffer(), triangles.size());
+	if (!same(classified.getClippedVertices(), clipped.getClippedVertices()) ||
+		!same(classified.getClippedTriangles(), clipped.getClippedTriangles())) {
+		printf("%s%s, rotation %g: classified triangles differ, %d vs %d vertices\n", name, cached ? " cached" : "",
+			   rotation, (int) classified.getClippedVertices().size(), (int) clipped.getClippedVertices().size());
+		testFailures++;
+	}
+
+	classified.clipEnd();
+	clipped.clipEnd();
+}
+
+int main() {
+	static const float square[] = {0, 0, 100, 0, 100, 100, 0, 100};
+	// Concave, so it is decomposed into several convex polygons sharing edges.
+	static const float l[] = {0, 0, 100, 0, 100, 50, 50, 50, 50, 100, 0, 100};
+	// The cut corner runs along a diagonal of grid vertices.
+	static const float pentagon[] = {0, 0, 100, 0, 100, 50, 50, 100, 0, 100};
+	for (int cached = 0; cached < 2; cached++) {
+		for (int r = 0; r < 2; r++) {
+			float rotation = r == 0 ? 0.0f : 90.0f;
+			testPolygon("square", square, 8, cached != 0, rotation);
+			testPolygon("L", l, 12, cached != 0, rotation);
+			testPolygon("pentagon", pentagon, 10, cached != 0, rotation);
+		}
+	}
+	return testResult("ClippingTest");
+}
@@ -0,0 +1,99 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Checks that Skeleton::getConservativeBounds() contains the exact bounds from Skeleton::getBounds() for every frame of
+// every animation of the example skeletons, with each of their skins.
+
+#include "TestUtil.h"
+
+#include <float.h>
+
+using namespace spine;
+
+static const char *names[] = {"alien", "celestial-circus", "coin", "dragon", "goblins", "hero", "mix-and-match", "owl",
+							  "powerup", "raptor", "sack", "snowglobe", "speedy", "spineboy",
+							  "stretchyman", "tank", "vine", "windmill"};
+
+// Both bounds come from the same world transforms, but the conservative bounds transform the mesh bounds instead of
+// each vertex, which rounds differently.
+static bool contains(float outer, float inner, float scale) {
+	return outer <= inner + scale * 1e-5f;
+}
+
+static void testSkeleton(const char *name) {
+	TestSkeleton test;
+	if (!test.load(name)) {
+		testFailures++;
+		return;
+	}
+	SkeletonData *data = test.data;
+	Skeleton skeleton(data);
+	Vector<float> vertices;
+	Vector<Skin *> &skins = data->getSkins();
+	Vector<Animation *> &animations = data->getAnimations();
+	int failures = 0, frames = 0;
+	for (size_t s = 0; s < skins.size(); s++) {
+		skeleton.setSkin(skins[s]);
+		for (size_t a = 0; a < animations.size(); a++) {
+			Animation *animation = animations[a];
+			skeleton.setToSetupPose();
+			int steps = (int) (animation->getDuration() * 30) + 1;
+			for (int i = 0; i < steps; i++) {
+				float time = i / 30.0f;
+				animation->apply(skeleton, time, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+				skeleton.update(1 / 30.0f);
+				skeleton.updateWorldTransform(Physics_Update);
+
+				float x, y, width, height;
+				skeleton.getBounds(x, y, width, height, vertices);
+				if (x == FLT_MAX) continue;
+				frames++;
+				float cx, cy, cwidth, cheight;
+				skeleton.getConservativeBounds(cx, cy, cwidth, cheight);
+				float scale = MathUtil::max(MathUtil::max(MathUtil::abs(x), MathUtil::abs(y)),
+											MathUtil::max(width, height)) + 1;
+				if (!contains(cx, x, scale) || !contains(cy, y, scale) || !contains(x + width, cx + cwidth, scale) ||
+					!contains(y + height, cy + cheight, scale)) {
+					if (failures++ < 5)
+						printf("%s, skin %s, %s at %.3f: bounds %g, %g, %g, %g not in %g, %g, %g, %g\n", name,
+							   skins[s]->getName().buffer(), animation->getName().buffer(), time, x, y, width, height,
+							   cx, cy, cwidth, cheight);
+				}
+			}
+		}
+	}
+	SPINE_CHECK(frames > 0);
+	testFailures += failures;
+}
+
+int main() {
+	for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++)
+		testSkeleton(names[i]);
+	return testResult("ConservativeBoundsTest");
+}
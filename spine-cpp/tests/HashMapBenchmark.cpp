@@ -0,0 +1,237 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Measures HashMap put, lookup and remove for the key types the runtime uses, PropertyId for timeline ids,
+// AnimationStateData's animation pairs and String, against a copy of the linked list map HashMap replaced.
+
+#include "TestUtil.h"
+
+using namespace spine;
+
+// The previous HashMap, a doubly linked list searched from the head.
+template<typename K, typename V>
+class ListHashMap : public SpineObject {
+public:
+	ListHashMap() : _head(NULL), _size(0) {
+	}
+
+	~ListHashMap() {
+		clear();
+	}
+
+	void clear() {
+		for (Entry *entry = _head; entry != NULL;) {
+			Entry *next = entry->next;
+			delete entry;
+			entry = next;
+		}
+		_head = NULL;
+		_size = 0;
+	}
+
+	size_t size() {
+		return _size;
+	}
+
+	void put(const K &key, const V &value) {
+		Entry *entry = find(key);
+		if (entry) {
+			entry->_key = key;
+			entry->_value = value;
+		} else {
+			entry = new (__FILE__, __LINE__) Entry();
+			entry->_key = key;
+			entry->_value = value;
+			Entry *oldHead = _head;
+			if (oldHead) {
+				_head = entry;
+				oldHead->prev = entry;
+				entry->next = oldHead;
+			} else {
+				_head = entry;
+			}
+			_size++;
+		}
+	}
+
+	bool containsKey(const K &key) {
+		return find(key) != NULL;
+	}
+
+	bool remove(const K &key) {
+		Entry *entry = find(key);
+		if (!entry) return false;
+		Entry *prev = entry->prev;
+		Entry *next = entry->next;
+		if (prev) prev->next = next;
+		else _head = next;
+		if (next) next->prev = entry->prev;
+		delete entry;
+		_size--;
+		return true;
+	}
+
+	V operator[](const K &key) {
+		Entry *entry = find(key);
+		return entry ? entry->_value : V();
+	}
+
+private:
+	class Entry : public SpineObject {
+	public:
+		K _key;
+		V _value;
+		Entry *next;
+		Entry *prev;
+
+		Entry() : next(NULL), prev(NULL) {
+		}
+	};
+
+	Entry *find(const K &key) {
+		for (Entry *entry = _head; entry != NULL; entry = entry->next) {
+			if (entry->_key == key) return entry;
+		}
+		return NULL;
+	}
+
+	Entry *_head;
+	size_t _size;
+};
+
+// The same as AnimationStateData's private AnimationPair.
+struct AnimationPair {
+	Animation *a1;
+	Animation *a2;
+
+	AnimationPair(Animation *a1 = NULL, Animation *a2 = NULL) : a1(a1), a2(a2) {
+	}
+
+	bool operator==(const AnimationPair &other) const {
+		return a1->getName() == other.a1->getName() && a2->getName() == other.a2->getName();
+	}
+
+	size_t hash() const {
+		const String &n1 = a1->getName(), &n2 = a2->getName();
+		return hashMapString(n1.buffer(), n1.length()) * 31 + hashMapString(n2.buffer(), n2.length());
+	}
+};
+
+struct Times {
+	double put, get, remove;
+};
+
+// Fills the map with all keys, looks each up and removes them again, rounds times. Returns nanoseconds per key.
+template<typename Map, typename K>
+static Times run(Vector<K> &keys, int rounds) {
+	Map map;
+	Times times = {0, 0, 0};
+	size_t count = keys.size();
+	for (int round = 0; round < rounds; round++) {
+		double start = timeSeconds();
+		for (size_t i = 0; i < count; i++)
+			map.put(keys[i], (int) i);
+		times.put += timeSeconds() - start;
+
+		start = timeSeconds();
+		size_t found = 0;
+		for (size_t i = 0; i < count; i++) {
+			if (map.containsKey(keys[i]) && map[keys[i]] == (int) i) found++;
+		}
+		times.get += timeSeconds() - start;
+		SPINE_CHECK(found == count);
+
+		start = timeSeconds();
+		for (size_t i = 0; i < count; i++)
+			map.remove(keys[i]);
+		times.remove += timeSeconds() - start;
+		SPINE_CHECK(map.size() == 0);
+	}
+	double scale = 1e9 / ((double) rounds * count);
+	times.put *= scale;
+	times.get *= scale;
+	times.remove *= scale;
+	return times;
+}
+
+template<typename K>
+static void compare(const char *label, Vector<K> &keys) {
+	int rounds = (int) (4000000 / (keys.size() * keys.size())) + 1;
+	Times hash = run<HashMap<K, int> >(keys, rounds);
+	Times list = run<ListHashMap<K, int> >(keys, rounds);
+	printf("%s, %d keys, ns per key: put %.1f vs %.1f, get %.1f vs %.1f, remove %.1f vs %.1f (HashMap vs list)\n", label,
+		   (int) keys.size(), hash.put, list.put, hash.get, list.get, hash.remove, list.remove);
+}
+
+int main() {
+	static const int counts[] = {8, 64, 512};
+	char name[64];
+	for (int c = 0; c < 3; c++) {
+		int count = counts[c];
+
+		// Timeline property ids put the property in the upper 32 bits and the bone or slot index in the lower.
+		Vector<PropertyId> ids;
+		for (int i = 0; i < count; i++)
+			ids.add(((PropertyId) (i % 20) << 32) | (PropertyId) (i / 20));
+		compare("PropertyId", ids);
+
+		Vector<String> strings;
+		for (int i = 0; i < count; i++) {
+			snprintf(name, sizeof(name), "attachments/part-%d", i);
+			strings.add(String(name));
+		}
+		compare("String", strings);
+
+		Vector<String> interned;
+		for (int i = 0; i < count; i++)
+			interned.add(StringTable::intern(strings[i]));
+		compare("Interned String", interned);
+	}
+
+	// Mixes between every pair of n animations.
+	static const int animationCounts[] = {3, 8, 22};
+	for (int c = 0; c < 3; c++) {
+		int n = animationCounts[c];
+		Vector<Animation *> animations;
+		Vector<Timeline *> timelines;
+		for (int i = 0; i < n; i++) {
+			snprintf(name, sizeof(name), "animation-%d", i);
+			animations.add(new Animation(name, timelines, 1));
+		}
+		Vector<AnimationPair> pairs;
+		for (int i = 0; i < n; i++) {
+			for (int ii = 0; ii < n; ii++)
+				pairs.add(AnimationPair(animations[i], animations[ii]));
+		}
+		compare("AnimationPair", pairs);
+		for (int i = 0; i < n; i++)
+			delete animations[i];
+	}
+	return testResult("HashMapBenchmark");
+}
@@ -0,0 +1,141 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Measures parsing the JSON exports of all examples into a Json tree, and loading them into skeleton data with
+// SkeletonJson, with attachments created without an atlas.
+
+#include "TestUtil.h"
+
+using namespace spine;
+
+// Creates attachments without looking up atlas regions, so exports can be loaded without their atlas.
+class NoAtlasAttachmentLoader : public AttachmentLoader {
+public:
+	virtual RegionAttachment *newRegionAttachment(Skin &skin, const String &name, const String &path, Sequence *sequence) {
+		SP_UNUSED(skin);
+		SP_UNUSED(path);
+		RegionAttachment *attachment = new (__FILE__, __LINE__) RegionAttachment(name);
+		attachment->setSequence(sequence);
+		return attachment;
+	}
+
+	virtual MeshAttachment *newMeshAttachment(Skin &skin, const String &name, const String &path, Sequence *sequence) {
+		SP_UNUSED(skin);
+		SP_UNUSED(path);
+		MeshAttachment *attachment = new (__FILE__, __LINE__) MeshAttachment(name);
+		attachment->setSequence(sequence);
+		return attachment;
+	}
+
+	virtual BoundingBoxAttachment *newBoundingBoxAttachment(Skin &skin, const String &name) {
+		SP_UNUSED(skin);
+		return new (__FILE__, __LINE__) BoundingBoxAttachment(name);
+	}
+
+	virtual PathAttachment *newPathAttachment(Skin &skin, const String &name) {
+		SP_UNUSED(skin);
+		return new (__FILE__, __LINE__) PathAttachment(name);
+	}
+
+	virtual PointAttachment *newPointAttachment(Skin &skin, const String &name) {
+		SP_UNUSED(skin);
+		return new (__FILE__, __LINE__) PointAttachment(name);
+	}
+
+	virtual ClippingAttachment *newClippingAttachment(Skin &skin, const String &name) {
+		SP_UNUSED(skin);
+		return new (__FILE__, __LINE__) ClippingAttachment(name);
+	}
+
+	virtual void configureAttachment(Attachment *attachment) {
+		SP_UNUSED(attachment);
+	}
+};
+
+static const int rounds = 10;
+
+int main() {
+	// SPINE_EXAMPLE_JSON lists the exports separated by '|'.
+	String paths(SPINE_EXAMPLE_JSON);
+	Vector<String> files;
+	Vector<Vector<char> *> texts;
+	const char *start = paths.buffer();
+	while (*start) {
+		const char *end = strchr(start, '|');
+		if (!end) end = start + strlen(start);
+		char buffer[1024];
+		size_t pathLength = MathUtil::min((size_t) (end - start), sizeof(buffer) - 1);
+		memcpy(buffer, start, pathLength);
+		buffer[pathLength] = 0;
+		String path(buffer);
+		int length = 0;
+		char *data = SpineExtension::readFile(path, &length);
+		SPINE_CHECK(data != NULL);
+		if (data) {
+			Vector<char> *text = new Vector<char>();
+			text->setSize(length + 1, 0);
+			memcpy(text->buffer(), data, length);
+			SpineExtension::free(data, __FILE__, __LINE__);
+			files.add(path);
+			texts.add(text);
+		}
+		start = *end ? end + 1 : end;
+	}
+	SPINE_CHECK(files.size() > 0);
+
+	double parse = 1e9, load = 1e9;
+	size_t bytes = 0;
+	for (size_t i = 0; i < texts.size(); i++)
+		bytes += texts[i]->size() - 1;
+	NoAtlasAttachmentLoader loader;
+	for (int round = 0; round < rounds; round++) {
+		double time = timeSeconds();
+		for (size_t i = 0; i < texts.size(); i++) {
+			Json json(texts[i]->buffer());
+			SPINE_CHECK(Json::getItem(&json, "skeleton") != NULL);
+		}
+		parse = MathUtil::min(parse, timeSeconds() - time);
+
+		time = timeSeconds();
+		for (size_t i = 0; i < texts.size(); i++) {
+			SkeletonJson reader(&loader);
+			SkeletonData *data = reader.readSkeletonData(texts[i]->buffer());
+			if (!data) printf("%s: %s\n", files[i].buffer(), reader.getError().buffer());
+			SPINE_CHECK(data != NULL);
+			delete data;
+		}
+		load = MathUtil::min(load, timeSeconds() - time);
+	}
+
+	printf("%d JSON exports, %.1f MB: parsing %.1f ms, loading skeleton data %.1f ms\n", (int) texts.size(),
+		   bytes / 1e6, parse * 1e3, load * 1e3);
+	for (size_t i = 0; i < texts.size(); i++)
+		delete texts[i];
+	return testResult("JsonBenchmark");
+}
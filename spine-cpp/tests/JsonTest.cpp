@@ -0,0 +1,53 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Checks that Json::getItem() finds the first item with a name, whatever was looked up before.
+
+#include "TestUtil.h"
+
+#include <spine/Json.h>
+
+using namespace spine;
+
+int main() {
+	Json root("{\"x\": 1, \"y\": 2, \"Name\": \"a\", \"x\": 3, \"@\": 4, \"`\": 5}");
+	SPINE_CHECK(Json::getInt(&root, "y", 0) == 2);
+	SPINE_CHECK(Json::getInt(&root, "x", 0) == 1);
+	SPINE_CHECK(Json::getInt(&root, "x", 0) == 1);
+	SPINE_CHECK(Json::getInt(&root, "y", 0) == 2);
+	SPINE_CHECK(strcmp(Json::getString(&root, "name", ""), "a") == 0);
+	SPINE_CHECK(Json::getInt(&root, "X", 0) == 1);
+	SPINE_CHECK(Json::getInt(&root, "@", 0) == 4);
+	SPINE_CHECK(Json::getInt(&root, "`", 0) == 5);
+	SPINE_CHECK(Json::getItem(&root, "z") == NULL);
+	SPINE_CHECK(Json::getItem(&root, "") == NULL);
+	SPINE_CHECK(Json::getItem(&root, 0) == Json::getItem(&root, "x"));
+	SPINE_CHECK(Json::getItem(&root, 3) != Json::getItem(&root, "x"));
+	return testResult("JsonTest");
+}
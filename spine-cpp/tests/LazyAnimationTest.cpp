@@ -0,0 +1,105 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Checks that lazily read animations stay loaded while loadAnimation() or a track entry uses them, whatever the memory
+// budget.
+
+#include "TestUtil.h"
+
+using namespace spine;
+
+int main() {
+	TestSkeleton spineboy;
+	spineboy.lazyAnimations = true;
+	if (!spineboy.load("spineboy")) return 1;
+	SkeletonData &data = *spineboy.data;
+	Vector<Animation *> &animations = data.getAnimations();
+	SPINE_CHECK(animations.size() > 3);
+	for (size_t i = 0; i < animations.size(); i++)
+		SPINE_CHECK(!animations[i]->isLoaded());
+
+	// Loaded explicitly, the animation is kept while other animations are loaded past the budget.
+	data.setAnimationMemoryBudget(1);
+	Animation *pinned = animations[0];
+	SPINE_CHECK(data.loadAnimation(pinned));
+	SPINE_CHECK(pinned->isLoaded());
+	size_t pinnedTimelines = pinned->getTimelines().size();
+	SPINE_CHECK(pinnedTimelines > 0);
+	for (size_t i = 1; i < animations.size(); i++) {
+		SPINE_CHECK(data.loadAnimation(animations[i]));
+		data.releaseAnimation(animations[i]);
+	}
+	SPINE_CHECK(pinned->isLoaded());
+	SPINE_CHECK(pinned->getTimelines().size() == pinnedTimelines);
+	data.unloadAnimation(pinned);
+	SPINE_CHECK(pinned->isLoaded());
+
+	// Loads nest.
+	SPINE_CHECK(data.loadAnimation(pinned));
+	data.releaseAnimation(pinned);
+	data.loadAnimation(animations[1]);
+	data.releaseAnimation(animations[1]);
+	SPINE_CHECK(pinned->isLoaded());
+
+	// Released, it is unloaded by the next decode over the budget.
+	data.releaseAnimation(pinned);
+	SPINE_CHECK(data.loadAnimation(animations[2]));
+	data.releaseAnimation(animations[2]);
+	SPINE_CHECK(!pinned->isLoaded());
+	SPINE_CHECK(data.getAnimationMemory() > 0);
+
+	// Track entries keep their animations loaded until they are disposed.
+	{
+		Skeleton skeleton(&data);
+		AnimationStateData stateData(&data);
+		AnimationState state(&stateData);
+		TrackEntry *entry = state.setAnimation(0, animations[2], true);
+		SPINE_CHECK(entry->getAnimation() == animations[2]);
+		state.addAnimation(1, animations[3], false, 0);
+		for (size_t i = 0; i < animations.size(); i++) {
+			data.loadAnimation(animations[i]);
+			data.releaseAnimation(animations[i]);
+		}
+		SPINE_CHECK(animations[2]->isLoaded() && animations[3]->isLoaded());
+		state.update(0.1f);
+		state.apply(skeleton);
+		state.clearTracks();
+		data.setAnimationMemoryBudget(1);
+		SPINE_CHECK(!animations[2]->isLoaded() && !animations[3]->isLoaded());
+	}
+	SPINE_CHECK(data.getAnimationMemory() == 0);
+
+	data.setAnimationMemoryBudget(0);
+	for (size_t i = 0; i < animations.size(); i++)
+		SPINE_CHECK(data.loadAnimation(animations[i]));
+	SPINE_CHECK(data.getAnimationMemory() > 0);
+	for (size_t i = 0; i < animations.size(); i++)
+		data.releaseAnimation(animations[i]);
+	return testResult("LazyAnimationTest");
+}
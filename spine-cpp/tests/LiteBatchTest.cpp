@@ -0,0 +1,174 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Checks that updating drawables with a spine-cpp-lite drawable batch, on the calling thread only and with worker
+// threads, gives the same poses, render commands and animation state events as the per drawable calls it replaces.
+
+#include "TestUtil.h"
+
+#include <spine-cpp-lite.h>
+
+using namespace spine;
+
+static const int numDrawables = 8;
+static const int frames = 150;
+static const float delta = 1 / 30.0f;
+
+static bool sameArray(const void *a, const void *b, size_t size) {
+	return size == 0 || (a && b && memcmp(a, b, size) == 0);
+}
+
+static bool sameRenderCommands(spine_render_command a, spine_render_command b) {
+	for (; a && b; a = spine_render_command_get_next(a), b = spine_render_command_get_next(b)) {
+		int32_t numVertices = spine_render_command_get_num_vertices(a), numIndices = spine_render_command_get_num_indices(a);
+		if (numVertices != spine_render_command_get_num_vertices(b) ||
+			numIndices != spine_render_command_get_num_indices(b) ||
+			spine_render_command_get_atlas_page(a) != spine_render_command_get_atlas_page(b) ||
+			spine_render_command_get_blend_mode(a) != spine_render_command_get_blend_mode(b))
+			return false;
+		size_t vertexFloats = numVertices * 2 * sizeof(float), vertexInts = numVertices * sizeof(int32_t);
+		if (!sameArray(spine_render_command_get_positions(a), spine_render_command_get_positions(b), vertexFloats) ||
+			!sameArray(spine_render_command_get_uvs(a), spine_render_command_get_uvs(b), vertexFloats) ||
+			!sameArray(spine_render_command_get_colors(a), spine_render_command_get_colors(b), vertexInts) ||
+			!sameArray(spine_render_command_get_dark_colors(a), spine_render_command_get_dark_colors(b), vertexInts) ||
+			!sameArray(spine_render_command_get_indices(a), spine_render_command_get_indices(b), numIndices * sizeof(uint16_t)))
+			return false;
+	}
+	return a == b;
+}
+
+static bool sameBones(spine_skeleton a, spine_skeleton b) {
+	Vector<Bone *> &bonesA = ((Skeleton *) a)->getBones(), &bonesB = ((Skeleton *) b)->getBones();
+	for (size_t i = 0; i < bonesA.size(); i++) {
+		Bone &boneA = *bonesA[i], &boneB = *bonesB[i];
+		if (boneA.getA() != boneB.getA() || boneA.getB() != boneB.getB() || boneA.getC() != boneB.getC() ||
+			boneA.getD() != boneB.getD() || boneA.getWorldX() != boneB.getWorldX() || boneA.getWorldY() != boneB.getWorldY())
+			return false;
+	}
+	return true;
+}
+
+static bool sameTrackEntry(spine_track_entry a, spine_track_entry b) {
+	return spine_track_entry_get_track_index(a) == spine_track_entry_get_track_index(b) &&
+		   strcmp(spine_animation_get_name(spine_track_entry_get_animation(a)),
+				  spine_animation_get_name(spine_track_entry_get_animation(b))) == 0;
+}
+
+static spine_skeleton_drawable newDrawable(SkeletonData *data, int index) {
+	static const char *animations[] = {"walk", "run", "jump", "shoot"};
+	spine_skeleton_drawable drawable = spine_skeleton_drawable_create((spine_skeleton_data) data);
+	spine_animation_state state = spine_skeleton_drawable_get_animation_state(drawable);
+	spine_animation_state_set_animation_by_name(state, 0, animations[index & 3], index & 1);
+	spine_animation_state_add_animation_by_name(state, 0, animations[(index + 1) & 3], 1, 0.5f);
+	if (index & 2) spine_animation_state_set_animation_by_name(state, 1, "aim", 1);
+	return drawable;
+}
+
+static void testBatch(SkeletonData *data, int32_t threadCount) {
+	spine_drawable_batch batch = spine_drawable_batch_create(threadCount);
+	spine_skeleton_drawable batched[numDrawables], single[numDrawables];
+	for (int i = 0; i < numDrawables; i++) {
+		batched[i] = newDrawable(data, i);
+		single[i] = newDrawable(data, i);
+		SPINE_CHECK(spine_drawable_batch_add(batch, batched[i]) == i);
+	}
+	SPINE_CHECK(spine_drawable_batch_get_num_drawables(batch) == numDrawables);
+
+	spine_render_command batchedCommands[numDrawables];
+	int numEvents = 0;
+	for (int frame = 0; frame < frames; frame++) {
+		bool render = (frame & 3) != 3;
+		spine_drawable_batch_update(batch, delta, SPINE_PHYSICS_UPDATE, render);
+		SPINE_CHECK(spine_drawable_batch_get_render_commands(batch, batchedCommands) == numDrawables);
+		int32_t batchEvents = spine_drawable_batch_get_num_events(batch);
+		int32_t *eventDrawables = spine_drawable_batch_get_event_drawables(batch);
+		int32_t *eventTypes = spine_drawable_batch_get_event_types(batch);
+		spine_track_entry *eventEntries = spine_drawable_batch_get_event_track_entries(batch);
+		spine_event *events = spine_drawable_batch_get_events(batch);
+
+		int32_t e = 0;
+		for (int i = 0; i < numDrawables; i++) {
+			spine_skeleton_drawable drawable = single[i];
+			spine_animation_state state = spine_skeleton_drawable_get_animation_state(drawable);
+			spine_skeleton skeleton = spine_skeleton_drawable_get_skeleton(drawable);
+			spine_animation_state_update(state, delta);
+			spine_animation_state_apply(state, skeleton);
+			spine_skeleton_update(skeleton, delta);
+			spine_skeleton_update_world_transform(skeleton, SPINE_PHYSICS_UPDATE);
+			spine_render_command commands = render ? spine_skeleton_drawable_render(drawable) : NULL;
+
+			if (!sameBones(skeleton, spine_skeleton_drawable_get_skeleton(batched[i]))) {
+				printf("Threads %d, frame %d, drawable %d: bones differ\n", threadCount, frame, i);
+				testFailures++;
+			}
+			if (!sameRenderCommands(commands, batchedCommands[i])) {
+				printf("Threads %d, frame %d, drawable %d: render commands differ\n", threadCount, frame, i);
+				testFailures++;
+			}
+
+			spine_animation_state_events stateEvents = spine_skeleton_drawable_get_animation_state_events(drawable);
+			for (int32_t ii = 0, n = spine_animation_state_events_get_num_events(stateEvents); ii < n; ii++, e++) {
+				spine_event_type type = spine_animation_state_events_get_event_type(stateEvents, ii);
+				spine_track_entry entry = spine_animation_state_events_get_track_entry(stateEvents, ii);
+				spine_event event = spine_animation_state_events_get_event(stateEvents, ii);
+				if (e >= batchEvents || eventDrawables[e] != i || eventTypes[e] != (int32_t) type ||
+					!sameTrackEntry(entry, eventEntries[e]) || (event == NULL) != (events[e] == NULL) ||
+					(event && (spine_event_get_data(event) != spine_event_get_data(events[e]) ||
+							   spine_event_get_time(event) != spine_event_get_time(events[e])))) {
+					printf("Threads %d, frame %d, drawable %d: event %d differs\n", threadCount, frame, i, ii);
+					testFailures++;
+					break;
+				}
+				if (type == SPINE_EVENT_TYPE_DISPOSE) {
+					spine_animation_state_dispose_track_entry(state, entry);
+					spine_animation_state_dispose_track_entry(
+							spine_skeleton_drawable_get_animation_state(batched[i]), eventEntries[e]);
+				}
+			}
+			spine_animation_state_events_reset(stateEvents);
+		}
+		SPINE_CHECK(e == batchEvents);
+		numEvents += batchEvents;
+	}
+	SPINE_CHECK(numEvents > 0);
+
+	spine_drawable_batch_dispose(batch);
+	for (int i = 0; i < numDrawables; i++) {
+		spine_skeleton_drawable_dispose(batched[i]);
+		spine_skeleton_drawable_dispose(single[i]);
+	}
+}
+
+int main() {
+	TestSkeleton spineboy;
+	if (!spineboy.load("spineboy")) return 1;
+	testBatch(spineboy.data, 0);
+	testBatch(spineboy.data, 2);
+	return testResult("LiteBatchTest");
+}
@@ -0,0 +1,138 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Checks that the bulk pose functions of spine-cpp-lite read and write the same values as the Bone and Slot getters
+// and setters, for all bones and slots and for selected indices, and stop at the first index out of range.
+
+#include "TestUtil.h"
+
+#include <spine-cpp-lite.h>
+
+using namespace spine;
+
+static void checkBones(Skeleton &skeleton, const int32_t *indices, int32_t count) {
+	Vector<float> transforms;
+	transforms.setSize(count * 6, 0);
+	int32_t processed = spine_skeleton_get_bone_world_transforms((spine_skeleton) &skeleton, indices, count,
+																 transforms.buffer());
+	SPINE_CHECK(processed == count);
+	for (int32_t i = 0; i < processed; i++) {
+		Bone &bone = *skeleton.getBones()[indices ? indices[i] : i];
+		float *transform = transforms.buffer() + i * 6;
+		SPINE_CHECK(transform[0] == bone.getA() && transform[1] == bone.getB() && transform[2] == bone.getC() &&
+					transform[3] == bone.getD() && transform[4] == bone.getWorldX() && transform[5] == bone.getWorldY());
+	}
+}
+
+static void checkSlots(Skeleton &skeleton, const int32_t *indices, int32_t count) {
+	Vector<float> colors;
+	colors.setSize(count * 4, 0);
+	Vector<spine_attachment> attachments;
+	attachments.setSize(count, NULL);
+	SPINE_CHECK(spine_skeleton_get_slot_colors((spine_skeleton) &skeleton, indices, count, colors.buffer()) == count);
+	SPINE_CHECK(spine_skeleton_get_slot_attachments((spine_skeleton) &skeleton, indices, count,
+													attachments.buffer()) == count);
+	for (int32_t i = 0; i < count; i++) {
+		Slot &slot = *skeleton.getSlots()[indices ? indices[i] : i];
+		Color &color = slot.getColor();
+		float *rgba = colors.buffer() + i * 4;
+		SPINE_CHECK(rgba[0] == color.r && rgba[1] == color.g && rgba[2] == color.b && rgba[3] == color.a);
+		SPINE_CHECK(attachments[i] == (spine_attachment) slot.getAttachment());
+	}
+}
+
+int main() {
+	TestSkeleton spineboy;
+	if (!spineboy.load("spineboy")) return 1;
+	Skeleton skeleton(spineboy.data);
+	AnimationStateData stateData(spineboy.data);
+	AnimationState state(&stateData);
+	state.setAnimation(0, "shoot", false);
+	state.addAnimation(0, "portal", true, 0);
+	int32_t numBones = (int32_t) skeleton.getBones().size(), numSlots = (int32_t) skeleton.getSlots().size();
+	int32_t boneIndices[] = {numBones - 1, 0, 3, 3, numBones / 2};
+	int32_t slotIndices[] = {numSlots - 1, 0, 5, numSlots / 2};
+
+	for (int frame = 0; frame < 120; frame++) {
+		state.update(1 / 30.0f);
+		state.apply(skeleton);
+		for (int32_t i = 0; i < numSlots; i++)
+			skeleton.getSlots()[i]->getColor().set(i / (float) numSlots, frame / 120.0f, 0.5f, 1 - i / (float) numSlots);
+		skeleton.updateWorldTransform(Physics_Update);
+
+		checkBones(skeleton, NULL, numBones);
+		checkBones(skeleton, boneIndices, 5);
+		checkSlots(skeleton, NULL, numSlots);
+		checkSlots(skeleton, slotIndices, 4);
+	}
+
+	// Only the bones before the first index out of range are read or written.
+	int32_t outOfRange[] = {1, numBones, 2};
+	float transforms[3 * 7];
+	SPINE_CHECK(spine_skeleton_get_bone_world_transforms((spine_skeleton) &skeleton, outOfRange, 3, transforms) == 1);
+	int32_t negative[] = {-1};
+	SPINE_CHECK(spine_skeleton_get_slot_colors((spine_skeleton) &skeleton, negative, 1, transforms) == 0);
+	SPINE_CHECK(spine_skeleton_get_bone_world_transforms((spine_skeleton) &skeleton, NULL, numBones + 5, NULL) == 0);
+	float bone2Rotation = skeleton.getBones()[2]->getRotation();
+	for (int i = 0; i < 3 * 7; i++)
+		transforms[i] = (float) (i + 1);
+	SPINE_CHECK(spine_skeleton_set_bone_local_transforms((spine_skeleton) &skeleton, outOfRange, 3, transforms) == 1);
+	Bone &bone1 = *skeleton.getBones()[1];
+	SPINE_CHECK(bone1.getX() == 1 && bone1.getY() == 2 && bone1.getRotation() == 3 && bone1.getScaleX() == 4 &&
+				bone1.getScaleY() == 5 && bone1.getShearX() == 6 && bone1.getShearY() == 7);
+	SPINE_CHECK(skeleton.getBones()[2]->getRotation() == bone2Rotation);
+
+	// Setting the local transforms of all bones gives the same world transforms as the setters.
+	Skeleton expected(spineboy.data);
+	Vector<float> locals;
+	for (int32_t i = 0; i < numBones; i++) {
+		float local[] = {i * 0.5f, -i * 0.25f, i * 7.0f, 1 + i * 0.01f, 1 - i * 0.01f, i * 0.3f, -i * 0.2f};
+		for (int ii = 0; ii < 7; ii++)
+			locals.add(local[ii]);
+		Bone &bone = *expected.getBones()[i];
+		bone.setX(local[0]);
+		bone.setY(local[1]);
+		bone.setRotation(local[2]);
+		bone.setScaleX(local[3]);
+		bone.setScaleY(local[4]);
+		bone.setShearX(local[5]);
+		bone.setShearY(local[6]);
+	}
+	SPINE_CHECK(spine_skeleton_set_bone_local_transforms((spine_skeleton) &skeleton, NULL, numBones, locals.buffer()) ==
+				numBones);
+	skeleton.updateWorldTransform(Physics_Update);
+	expected.updateWorldTransform(Physics_Update);
+	Vector<float> actualWorld, expectedWorld;
+	actualWorld.setSize(numBones * 6, 0);
+	expectedWorld.setSize(numBones * 6, 0);
+	spine_skeleton_get_bone_world_transforms((spine_skeleton) &skeleton, NULL, numBones, actualWorld.buffer());
+	spine_skeleton_get_bone_world_transforms((spine_skeleton) &expected, NULL, numBones, expectedWorld.buffer());
+	SPINE_CHECK(memcmp(actualWorld.buffer(), expectedWorld.buffer(), numBones * 6 * sizeof(float)) == 0);
+	return testResult("LiteBulkTest");
+}
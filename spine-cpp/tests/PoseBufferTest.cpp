@@ -0,0 +1,95 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Checks that updating world transforms with the pose buffer, see Skeleton::setUsePoseBuffer(), gives the same bone
+// transforms as the scalar path for every animation of the example skeletons.
+
+#include "TestUtil.h"
+
+using namespace spine;
+
+static bool sameBones(Skeleton &a, Skeleton &b) {
+	Vector<Bone *> &bonesA = a.getBones(), &bonesB = b.getBones();
+	for (size_t i = 0; i < bonesA.size(); i++) {
+		Bone &boneA = *bonesA[i], &boneB = *bonesB[i];
+		if (boneA.getA() != boneB.getA() || boneA.getB() != boneB.getB() || boneA.getC() != boneB.getC() ||
+			boneA.getD() != boneB.getD() || boneA.getWorldX() != boneB.getWorldX() ||
+			boneA.getWorldY() != boneB.getWorldY()) {
+			printf("Bone %s differs\n", boneA.getData().getName().buffer());
+			return false;
+		}
+	}
+	return true;
+}
+
+static void testSkeleton(const char *name) {
+	TestSkeleton test;
+	if (!test.load(name)) {
+		testFailures++;
+		return;
+	}
+	SkeletonData *data = test.data;
+	AnimationStateData stateData(data);
+	Vector<Animation *> &animations = data->getAnimations();
+	for (size_t i = 0; i < animations.size(); i++) {
+		Skeleton scalar(data), batched(data);
+		batched.setUsePoseBuffer(true);
+		SPINE_CHECK(batched.getUsePoseBuffer());
+		if (data->getSkins().size() > 1) {
+			scalar.setSkin(data->getSkins()[1]);
+			batched.setSkin(data->getSkins()[1]);
+		}
+		AnimationState stateScalar(&stateData), stateBatched(&stateData);
+		stateScalar.setAnimation(0, animations[i], true);
+		stateBatched.setAnimation(0, animations[i], true);
+		bool same = true;
+		for (int frame = 0; frame < 60 && same; frame++) {
+			float delta = 1 / 30.0f;
+			stateScalar.update(delta);
+			stateScalar.apply(scalar);
+			scalar.update(delta);
+			scalar.updateWorldTransform(Physics_Update);
+			stateBatched.update(delta);
+			stateBatched.apply(batched);
+			batched.update(delta);
+			batched.updateWorldTransform(Physics_Update);
+			same = sameBones(scalar, batched);
+		}
+		if (!same) printf("%s, %s\n", name, animations[i]->getName().buffer());
+		SPINE_CHECK(same);
+	}
+}
+
+int main() {
+	const char *names[] = {"spineboy", "raptor", "owl", "tank", "stretchyman", "goblins", "mix-and-match",
+						   "celestial-circus", "dragon", "vine"};
+	for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++)
+		testSkeleton(names[i]);
+	return testResult("PoseBufferTest");
+}
@@ -0,0 +1,185 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Checks that SkeletonBounds reusing its polygons matches freshly built bounds, and that SkeletonBoundsGrid finds the
+// same hits as testing every polygon.
+
+#include "TestUtil.h"
+
+#include <stdlib.h>
+
+using namespace spine;
+
+static bool sameBounds(SkeletonBounds &bounds, Skeleton &skeleton) {
+	SkeletonBounds fresh;
+	fresh.update(skeleton, true);
+	if (fresh.getPolygons().size() != bounds.getPolygons().size()) return false;
+	if (fresh.getMinX() != bounds.getMinX() || fresh.getMinY() != bounds.getMinY() ||
+		fresh.getMaxX() != bounds.getMaxX() || fresh.getMaxY() != bounds.getMaxY())
+		return false;
+	for (size_t i = 0; i < fresh.getPolygons().size(); i++) {
+		Polygon *a = fresh.getPolygons()[i], *b = bounds.getPolygons()[i];
+		if (fresh.getBoundingBoxes()[i] != bounds.getBoundingBoxes()[i] || a->_count != b->_count) return false;
+		for (int ii = 0; ii < a->_count; ii++)
+			if (a->_vertices[ii] != b->_vertices[ii]) return false;
+	}
+	return true;
+}
+
+static BoundingBoxAttachment *newBox(float size) {
+	BoundingBoxAttachment *box = new BoundingBoxAttachment("box");
+	float vertices[] = {-size, -size, size, -size * 0.5f, size, size, -size * 0.7f, size, -size * 1.2f, 0};
+	for (int i = 0; i < 10; i++)
+		box->getVertices().add(vertices[i]);
+	box->setWorldVerticesLength(10);
+	return box;
+}
+
+static void testDeform(SkeletonData *data) {
+	Skeleton skeleton(data);
+	skeleton.updateWorldTransform(Physics_Update);
+	BoundingBoxAttachment *box = newBox(30);
+	Slot *slot = skeleton.getSlots()[3];
+	slot->setAttachment(box);
+
+	SkeletonBounds bounds;
+	bounds.update(skeleton, true);
+	SPINE_CHECK(bounds.getPolygons().size() == 1);
+	SPINE_CHECK(sameBounds(bounds, skeleton));
+
+	// Deformed while the bone does not move.
+	Vector<float> &deform = slot->getDeform();
+	for (size_t i = 0; i < box->getVertices().size(); i++)
+		deform.add(box->getVertices()[i] + 50);
+	bounds.update(skeleton, true);
+	SPINE_CHECK(sameBounds(bounds, skeleton));
+
+	// Undeformed again, as DeformTimeline::apply() and setSlotsToSetupPose() do, while the bone does not move.
+	deform.clear();
+	bounds.update(skeleton, true);
+	SPINE_CHECK(sameBounds(bounds, skeleton));
+
+	// Attachment removed, then added back.
+	slot->setAttachment(NULL);
+	bounds.update(skeleton, true);
+	SPINE_CHECK(bounds.getPolygons().size() == 0);
+	slot->setAttachment(box);
+	bounds.update(skeleton, true);
+	SPINE_CHECK(sameBounds(bounds, skeleton));
+
+	slot->setAttachment(NULL);
+	delete box;
+}
+
+static void testAnimated(SkeletonData *data) {
+	const int count = 100;
+	BoundingBoxAttachment *boxes[4];
+	for (int i = 0; i < 4; i++)
+		boxes[i] = newBox(20.0f + i * 15);
+
+	AnimationStateData stateData(data);
+	Vector<Skeleton *> skeletons;
+	Vector<AnimationState *> states;
+	Vector<SkeletonBounds *> bounds;
+	SkeletonBoundsGrid grid(300);
+	srand(1);
+	for (int i = 0; i < count; i++) {
+		Skeleton *skeleton = new Skeleton(data);
+		skeleton->setX((float) (rand() % 6000 - 3000));
+		skeleton->setY((float) (rand() % 6000 - 3000));
+		AnimationState *state = new AnimationState(&stateData);
+		state->setAnimation(0, data->getAnimations()[i % data->getAnimations().size()], true);
+		skeletons.add(skeleton);
+		states.add(state);
+		bounds.add(new SkeletonBounds());
+		grid.add(bounds[i]);
+	}
+
+	Vector<SkeletonBounds *> hitBounds;
+	Vector<BoundingBoxAttachment *> hitBoxes;
+	size_t hits = 0;
+	for (int frame = 0; frame < 40; frame++) {
+		for (int i = 0; i < count; i++) {
+			Skeleton &skeleton = *skeletons[i];
+			// Half of the skeletons pause every few frames, so their polygons are reused.
+			if (frame % 10 < 5 || i % 2) {
+				states[i]->update(1 / 30.0f);
+				states[i]->apply(skeleton);
+			}
+			for (int ii = 0; ii < 4; ii++) {
+				Slot *slot = skeleton.getSlots()[(ii * 7 + 3) % skeleton.getSlots().size()];
+				slot->setAttachment(frame % 7 == ii && i % 3 == 0 ? NULL : boxes[ii]);
+			}
+			skeleton.updateWorldTransform(Physics_Update);
+			bounds[i]->update(skeleton, true);
+			SPINE_CHECK(sameBounds(*bounds[i], skeleton));
+		}
+
+		grid.update();
+		for (int query = 0; query < 50; query++) {
+			Skeleton &near = *skeletons[rand() % count];
+			float x = near.getX() + rand() % 200 - 100, y = near.getY() + rand() % 400;
+			size_t expected = 0;
+			for (int i = 0; i < count; i++) {
+				Vector<Polygon *> &polygons = bounds[i]->getPolygons();
+				for (size_t ii = 0; ii < polygons.size(); ii++)
+					if (bounds[i]->containsPoint(polygons[ii], x, y)) expected++;
+			}
+			size_t found = grid.containsPoint(x, y, hitBounds, hitBoxes);
+			SPINE_CHECK(found == expected);
+			hits += found;
+
+			float x2 = x + rand() % 600 - 300, y2 = y + rand() % 600 - 300;
+			expected = 0;
+			for (int i = 0; i < count; i++) {
+				Vector<Polygon *> &polygons = bounds[i]->getPolygons();
+				for (size_t ii = 0; ii < polygons.size(); ii++)
+					if (bounds[i]->intersectsSegment(polygons[ii], x, y, x2, y2)) expected++;
+			}
+			SPINE_CHECK(grid.intersectsSegment(x, y, x2, y2, hitBounds, hitBoxes) == expected);
+		}
+	}
+	SPINE_CHECK(hits > 0);
+
+	for (int i = 0; i < count; i++) {
+		delete bounds[i];
+		delete states[i];
+		delete skeletons[i];
+	}
+	for (int i = 0; i < 4; i++)
+		delete boxes[i];
+}
+
+int main() {
+	TestSkeleton spineboy;
+	if (!spineboy.load("spineboy")) return 1;
+	testDeform(spineboy.data);
+	testAnimated(spineboy.data);
+	return testResult("SkeletonBoundsTest");
+}
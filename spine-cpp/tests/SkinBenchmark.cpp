@@ -0,0 +1,90 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Measures assembling a skin from parts at runtime and changing a skeleton to it, as in the mix-and-match example,
+// compared to changing between the skeleton data's own skins.
+
+#include "TestUtil.h"
+
+using namespace spine;
+
+static const char *parts[] = {"skin-base", "nose/short", "eyelids/girly", "eyes/violet", "hair/brown",
+							  "clothes/hoodie-orange", "legs/pants-jeans", "accessories/bag", "accessories/hat-red-yellow"};
+static const int numParts = sizeof(parts) / sizeof(parts[0]);
+static const int iterations = 2000;
+
+int main() {
+	TestSkeleton mixAndMatch;
+	if (!mixAndMatch.load("mix-and-match")) return 1;
+	SkeletonData *data = mixAndMatch.data;
+	Skin *partSkins[numParts];
+	for (int i = 0; i < numParts; i++) {
+		partSkins[i] = data->findSkin(parts[i]);
+		SPINE_CHECK(partSkins[i] != NULL);
+		if (!partSkins[i]) return testResult("SkinBenchmark");
+	}
+	Skin *dataSkins[] = {data->findSkin("full-skins/girl"), data->findSkin("full-skins/boy")};
+
+	Skeleton skeleton(data);
+	double assemble = 0, setCustom = 0, setData = 0;
+	for (int i = 0; i < iterations; i++) {
+		double start = timeSeconds();
+		Skin *skin = new Skin("custom");
+		for (int ii = 0; ii < numParts; ii++)
+			skin->addSkin(partSkins[ii]);
+		assemble += timeSeconds() - start;
+
+		start = timeSeconds();
+		skeleton.setSkin(skin);
+		skeleton.setSlotsToSetupPose();
+		setCustom += timeSeconds() - start;
+
+		start = timeSeconds();
+		skeleton.setSkin(dataSkins[i & 1]);
+		skeleton.setSlotsToSetupPose();
+		setData += timeSeconds() - start;
+
+		if (i == 0) {
+			// The assembled skin has the attachments of its parts.
+			for (int ii = 0; ii < numParts; ii++) {
+				Skin::AttachmentMap::Entries entries = partSkins[ii]->getAttachments();
+				while (entries.hasNext()) {
+					Skin::AttachmentMap::Entry &entry = entries.next();
+					SPINE_CHECK(skin->getAttachment(entry._slotIndex, entry._name) != NULL);
+				}
+			}
+		}
+		delete skin;
+	}
+
+	double scale = 1e6 / iterations;
+	printf("%d parts: assembling %.2f us, setSkin() with the assembled skin %.2f us, with a data skin %.2f us\n", numParts,
+		   assemble * scale, setCustom * scale, setData * scale);
+	return testResult("SkinBenchmark");
+}
@@ -0,0 +1,73 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Checks that only the loaders add names to the StringTable, and that skins find attachments whether or not their
+// names are interned.
+
+#include "TestUtil.h"
+
+using namespace spine;
+
+int main() {
+	size_t count;
+	{
+		TestSkeleton spineboy;
+		if (!spineboy.load("spineboy")) return 1;
+		count = StringTable::getCount();
+		SPINE_CHECK(count > 0);
+
+		Skin *skin = spineboy.data->getDefaultSkin();
+		Skin::AttachmentMap::Entries entries = skin->getAttachments();
+		SPINE_CHECK(entries.hasNext());
+		Skin::AttachmentMap::Entry &entry = entries.next();
+		SPINE_CHECK(entry._name.isInterned());
+		String copy(entry._name.buffer());
+		SPINE_CHECK(!copy.isInterned());
+		SPINE_CHECK(skin->getAttachment(entry._slotIndex, copy) == entry._attachment);
+
+		// Names set at runtime are copied, not interned.
+		Skin custom("custom");
+		custom.setAttachment(entry._slotIndex, "runtime name", entry._attachment->copy());
+		custom.addSkin(skin);
+		SPINE_CHECK(StringTable::getCount() == count);
+		SPINE_CHECK(custom.getAttachment(entry._slotIndex, "runtime name") != NULL);
+		SPINE_CHECK(custom.getAttachment(entry._slotIndex, entry._name) == entry._attachment);
+		SPINE_CHECK(custom.getAttachment(entry._slotIndex, copy) == entry._attachment);
+		custom.removeAttachment(entry._slotIndex, "runtime name");
+		SPINE_CHECK(custom.getAttachment(entry._slotIndex, "runtime name") == NULL);
+	}
+
+	// Interned strings outlive the data until the table is cleared.
+	SPINE_CHECK(StringTable::getCount() == count);
+	String a = StringTable::intern("name"), b = StringTable::intern(String("name"));
+	SPINE_CHECK(a.isInterned() && a.buffer() == b.buffer());
+	StringTable::clear();
+	SPINE_CHECK(StringTable::getCount() == 0);
+	return testResult("StringTableTest");
+}
@@ -0,0 +1,122 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_TestUtil_h
+#define Spine_TestUtil_h
+
+#include <spine/spine.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+
+// Shared by the tests and benchmarks, each of which is a single source file.
+
+// spine-cpp-lite defines its own default extension.
+#ifndef SPINE_TEST_LITE
+spine::SpineExtension *spine::getDefaultExtension() {
+	return new spine::DefaultSpineExtension();
+}
+#endif
+
+static int testFailures = 0;
+
+#define SPINE_CHECK(condition) \
+	do { \
+		if (!(condition)) { \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			testFailures++; \
+		} \
+	} while (0)
+
+// Returns the process exit code.
+static inline int testResult(const char *name) {
+	if (testFailures > 0) {
+		printf("%s: %d checks failed\n", name, testFailures);
+		return 1;
+	}
+	printf("%s: passed\n", name);
+	return 0;
+}
+
+// Seconds from a monotonic clock, for the benchmarks.
+static inline double timeSeconds() {
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// A skeleton from the examples directory with the atlas it references.
+struct TestSkeleton {
+	spine::Atlas *atlas;
+	spine::SkeletonData *data;
+	bool lazyAnimations; // See SkeletonBinary::setLazyAnimations().
+
+	TestSkeleton() : atlas(NULL), data(NULL), lazyAnimations(false) {
+	}
+
+	~TestSkeleton() {
+		delete data;
+		delete atlas;
+	}
+
+	// Loads examples/<name>/export/<name>-pro.skel, or <name>-ess.skel if there is no pro export.
+	bool load(const char *name, bool json = false) {
+		char path[1024];
+		const char *atlasSuffixes[] = {".atlas", "-pma.atlas"};
+		for (int i = 0; i < 2 && !atlas; i++) {
+			snprintf(path, sizeof(path), "%s/%s/export/%s%s", SPINE_EXAMPLES_DIR, name, name, atlasSuffixes[i]);
+			FILE *file = fopen(path, "rb");
+			if (!file) continue;
+			fclose(file);
+			atlas = new spine::Atlas(path, NULL);
+		}
+		if (!atlas) {
+			printf("No atlas for %s\n", name);
+			return false;
+		}
+		const char *editions[] = {"pro", "ess"};
+		for (int i = 0; i < 2 && !data; i++) {
+			snprintf(path, sizeof(path), "%s/%s/export/%s-%s.%s", SPINE_EXAMPLES_DIR, name, name, editions[i], json ? "json" : "skel");
+			FILE *file = fopen(path, "rb");
+			if (!file) continue;
+			fclose(file);
+			if (json) {
+				spine::SkeletonJson loader(atlas);
+				data = loader.readSkeletonDataFile(path);
+			} else {
+				spine::SkeletonBinary loader(atlas);
+				loader.setLazyAnimations(lazyAnimations);
+				data = loader.readSkeletonDataFile(path);
+			}
+		}
+		if (!data) printf("Couldn't load %s\n", name);
+		return data != NULL;
+	}
+};
+
+#endif /* Spine_TestUtil_h */
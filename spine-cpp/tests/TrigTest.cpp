@@ -0,0 +1,180 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Checks the precision of MathUtil::sinCos(), that batched results equal single results and that the world transforms
+// Bone and Skeleton compute with it match double precision trig. Built twice, against spine-cpp with the default backend
+// and against spine-cpp built with SPINE_FAST_TRIG, see CMakeLists.txt.
+
+#include "TestUtil.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+using namespace spine;
+
+static bool sameBits(float a, float b) {
+	return memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+// Returns the largest absolute error of sinCos() against double precision for angles in [-range, range].
+static double maxError(double range, int count) {
+	double maxError = 0;
+	srand(1);
+	for (int i = 0; i < count; i++) {
+		// Evenly spaced angles, plus random ones between them.
+		float radians = (float) (-range + 2 * range * i / (count - 1));
+		if (i & 1) radians = (float) (-range + 2 * range * (rand() / (double) RAND_MAX));
+		float sin, cos;
+		MathUtil::sinCos(radians, sin, cos);
+		double sinError = fabs(sin - ::sin((double) radians)), cosError = fabs(cos - ::cos((double) radians));
+		if (sinError > maxError) maxError = sinError;
+		if (cosError > maxError) maxError = cosError;
+	}
+	return maxError;
+}
+
+static void testBatch() {
+	const int count = 1027;
+	float radians[count], sin[count], cos[count], inPlace[count];
+	srand(2);
+	for (int i = 0; i < count; i++)
+		radians[i] = inPlace[i] = (float) ((rand() / (double) RAND_MAX - 0.5) * 2000);
+	radians[0] = inPlace[0] = 0;
+	radians[1] = inPlace[1] = -0.0f;
+	radians[2] = inPlace[2] = MathUtil::Pi;
+	radians[3] = inPlace[3] = MathUtil::Pi_2;
+	MathUtil::sinCos(radians, sin, cos, count);
+	for (int i = 0; i < count; i++) {
+		float singleSin, singleCos;
+		MathUtil::sinCos(radians[i], singleSin, singleCos);
+		SPINE_CHECK(sameBits(sin[i], singleSin));
+		SPINE_CHECK(sameBits(cos[i], singleCos));
+		SPINE_CHECK(sameBits(MathUtil::sin(radians[i]), singleSin));
+		SPINE_CHECK(sameBits(MathUtil::cos(radians[i]), singleCos));
+	}
+
+	// Output arrays may be the input array.
+	MathUtil::sinCos(inPlace, inPlace, cos, count);
+	for (int i = 0; i < count; i++)
+		SPINE_CHECK(sameBits(inPlace[i], sin[i]));
+}
+
+static bool isConstrained(Skeleton &skeleton, Bone *bone) {
+	for (size_t i = 0; i < skeleton.getIkConstraints().size(); i++)
+		if (skeleton.getIkConstraints()[i]->getBones().contains(bone)) return true;
+	for (size_t i = 0; i < skeleton.getTransformConstraints().size(); i++)
+		if (skeleton.getTransformConstraints()[i]->getBones().contains(bone)) return true;
+	for (size_t i = 0; i < skeleton.getPathConstraints().size(); i++)
+		if (skeleton.getPathConstraints()[i]->getBones().contains(bone)) return true;
+	for (size_t i = 0; i < skeleton.getPhysicsConstraints().size(); i++)
+		if (skeleton.getPhysicsConstraints()[i]->getBone() == bone) return true;
+	return false;
+}
+
+// Poses the skeleton with each frame of its animations, with and without the pose buffer, and checks the world matrix of
+// each bone with Inherit_Normal that no constraint changes against its parent's and its applied transform, using double
+// precision trig.
+static void testSkeleton(const char *name) {
+	TestSkeleton test;
+	if (!test.load(name)) {
+		testFailures++;
+		return;
+	}
+	Skeleton skeleton(test.data);
+	Vector<Bone *> &bones = skeleton.getBones();
+	Vector<Animation *> &animations = test.data->getAnimations();
+	int checked = 0, failures = 0;
+	double maxError = 0;
+	for (int poseBuffer = 0; poseBuffer < 2; poseBuffer++) {
+		skeleton.setUsePoseBuffer(poseBuffer != 0);
+		for (size_t a = 0; a < animations.size(); a++) {
+			Animation *animation = animations[a];
+			skeleton.setToSetupPose();
+			int steps = (int) (animation->getDuration() * 30) + 1;
+			for (int i = 0; i < steps; i++) {
+				float time = i / 30.0f;
+				animation->apply(skeleton, time, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+				skeleton.update(1 / 30.0f);
+				skeleton.updateWorldTransform(Physics_Update);
+				for (size_t b = 0; b < bones.size(); b++) {
+					Bone *bone = bones[b], *parent = bone->getParent();
+					if (!parent || !bone->isActive() || bone->getInherit() != Inherit_Normal ||
+						isConstrained(skeleton, bone))
+						continue;
+					float rx = (bone->getAppliedRotation() + bone->getAShearX()) * MathUtil::Deg_Rad;
+					float ry = (bone->getAppliedRotation() + 90 + bone->getAShearY()) * MathUtil::Deg_Rad;
+					double la = ::cos((double) rx) * bone->getAScaleX(), lb = ::cos((double) ry) * bone->getAScaleY();
+					double lc = ::sin((double) rx) * bone->getAScaleX(), ld = ::sin((double) ry) * bone->getAScaleY();
+					double pa = parent->getA(), pb = parent->getB(), pc = parent->getC(), pd = parent->getD();
+					double expected[] = {pa * la + pb * lc, pa * lb + pb * ld, pc * la + pd * lc, pc * lb + pd * ld};
+					float actual[] = {bone->getA(), bone->getB(), bone->getC(), bone->getD()};
+					// Each value sums two products, each off by about the trig error times their factors.
+					double scale = (MathUtil::abs(pa) + MathUtil::abs(pb) + MathUtil::abs(pc) + MathUtil::abs(pd)) *
+								   (MathUtil::abs(bone->getAScaleX()) + MathUtil::abs(bone->getAScaleY())) + 1;
+					for (int v = 0; v < 4; v++) {
+						double error = fabs(actual[v] - expected[v]) / scale;
+						if (error > maxError) maxError = error;
+						if (error > 1e-6 && failures++ < 5)
+							printf("%s, %s at %.3f, bone %s: %g instead of %g\n", name, animation->getName().buffer(), time,
+								   bone->getData().getName().buffer(), actual[v], expected[v]);
+					}
+					checked++;
+				}
+			}
+		}
+	}
+	printf("%s: %d bone poses, max world matrix error %g\n", name, checked, maxError);
+	SPINE_CHECK(checked > 0);
+	testFailures += failures;
+}
+
+int main() {
+	testBatch();
+	const char *names[] = {"dragon", "owl", "raptor", "spineboy", "stretchyman"};
+	for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++)
+		testSkeleton(names[i]);
+#ifdef SPINE_FAST_TRIG
+	double error1000 = maxError(1000, 1 << 22), error100000 = maxError(100000, 1 << 22);
+	printf("Fast trig, max error up to 1000 radians: %g, up to 10^5 radians: %g\n", error1000, error100000);
+	SPINE_CHECK(error1000 < 8e-8);
+	SPINE_CHECK(error100000 < 1e-6);
+	SPINE_CHECK(maxError(MathUtil::Pi, 1 << 16) < 8e-8);
+	return testResult("TrigTestFast");
+#else
+	// The default backend gives the same results as the standard library called with a float, as before sinCos().
+	for (int i = -100000; i <= 100000; i++) {
+		float radians = i * 0.01f, sin, cos;
+		MathUtil::sinCos(radians, sin, cos);
+		SPINE_CHECK(sameBits(sin, (float) ::sin(radians)));
+		SPINE_CHECK(sameBits(cos, (float) ::cos(radians)));
+	}
+	printf("Default trig, max error up to 1000 radians: %g\n", maxError(1000, 1 << 20));
+	return testResult("TrigTest");
+#endif
+}
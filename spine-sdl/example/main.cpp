@@ -97,6 +97,7 @@ int main() {
 		delete skeletonData;
 	}
 	delete skeletonRenderer;
+	spine::StringTable::clear();
 	dbgExtension.reportLeaks();
 	return 0;
 }
@@ -795,6 +795,7 @@ int main() {
 	testcase(stretchyman, "data/stretchyman-pro.json", "data/stretchyman-pro.skel", "data/stretchyman-pma.atlas", 0.6f);
 
     delete skeletonRenderer;
+	StringTable::clear();
 	dbgExtension.reportLeaks();
 	return 0;
 }